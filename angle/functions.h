@@ -43,6 +43,7 @@
 //----------------------------------------------------------------------
 // External includes with <>
 //----------------------------------------------------------------------
+#include <cstddef>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -62,28 +63,278 @@ namespace math
 
 /*! Analogous function to std::asin but returns a proper tAngle-value directly
  *
+ * The trigonometry policy allows to select a faster approximation, e.g. ASin<angle::Polynomial<7>>(x)
  */
-template <typename T>
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ASin(T sine);
 
 /*! Analogous function to std::acos but returns a proper tAngle-value directly
  *
+ * The trigonometry policy allows to select a faster approximation
  */
-template <typename T>
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ACos(T cosine);
 
 /*! Analogous function to std::acos but returns a proper tAngle-value directly
  *
+ * The trigonometry policy allows to select a faster approximation
  */
-template <typename T>
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ATan(T tangent);
 
 /*! Analogous function to std::atan2 but returns a proper tAngle-value directly
  *
+ * The trigonometry policy allows to select a faster approximation
  */
-template <typename TY, typename TX>
+template <typename TTrigonometryPolicy = angle::Exact, typename TY, typename TX>
 tAngle < decltype(TY() + TX()), angle::Radian, angle::NoWrap > ATan2(TY y, TX x);
 
+/*! Arc sine of an array of values
+ *
+ * The loop is kept free of branches to allow vectorization when used
+ * with an approximating trigonometry policy.
+ *
+ * \param sine     The input values
+ * \param radians  The output array for the angles in radians (may be the same as \a sine)
+ * \param count    The number of values
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
+void ASin(const T *sine, T *radians, size_t count);
+
+/*! Arc cosine of an array of values
+ *
+ * \param cosine   The input values
+ * \param radians  The output array for the angles in radians (may be the same as \a cosine)
+ * \param count    The number of values
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
+void ACos(const T *cosine, T *radians, size_t count);
+
+/*! Arc tangent of an array of values
+ *
+ * \param tangent  The input values
+ * \param radians  The output array for the angles in radians (may be the same as \a tangent)
+ * \param count    The number of values
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
+void ATan(const T *tangent, T *radians, size_t count);
+
+/*! Two-argument arc tangent of arrays of coordinates
+ *
+ * Typically used to convert many cartesian points to polar angles, e.g.
+ * ATan2<angle::Polynomial<7>>(y, x, alpha, count).
+ *
+ * \param y        The y coordinates
+ * \param x        The x coordinates
+ * \param radians  The output array for the angles in radians (may be the same as \a y or \a x)
+ * \param count    The number of values
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
+void ATan2(const T *y, const T *x, T *radians, size_t count);
+
+/*! Wrap an array of raw angle values to the signed circle
+ *
+ * Batch counterpart of tAngle::WrapSigned. The values are interpreted in
+ * the given unit, e.g. WrapSigned<angle::Degree>(values, count).
+ * Integral values (binary angles) wrap modulo the range of their type.
+ * The loop is kept free of branches to allow vectorization.
+ *
+ * \param values  The values to wrap in place
+ * \param count   The number of values
+ */
+template <typename TUnitPolicy = angle::Radian, typename T>
+void WrapSigned(T *values, size_t count);
+
+/*! Wrap an array of angles to the signed circle
+ *
+ * The results are stored in an array of signed angles, so that the wrap
+ * policy of \a angles is never violated. No temporary angles are created.
+ *
+ * \param angles   The angles to wrap
+ * \param wrapped  The output array for the wrapped angles
+ * \param count    The number of angles
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void WrapSigned(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, tAngle<TElement, TUnitPolicy, angle::Signed> *wrapped, size_t count);
+
+/*! Wrap an array of raw angle values to the unsigned circle
+ *
+ * Batch counterpart of tAngle::WrapUnsigned, see WrapSigned.
+ *
+ * \param values  The values to wrap in place
+ * \param count   The number of values
+ */
+template <typename TUnitPolicy = angle::Radian, typename T>
+void WrapUnsigned(T *values, size_t count);
+
+/*! Wrap an array of angles to the unsigned circle
+ *
+ * \param angles   The angles to wrap
+ * \param wrapped  The output array for the wrapped angles
+ * \param count    The number of angles
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void WrapUnsigned(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, tAngle<TElement, TUnitPolicy, angle::Unsigned> *wrapped, size_t count);
+
+/*! Convert an array of raw angle values from one unit to another
+ *
+ * E.g. ConvertUnit<angle::Radian, angle::Degree>(degrees, radians, count).
+ * The values are not wrapped.
+ *
+ * \param source  The values in the source unit
+ * \param target  The output array for the values in the target unit (may be the same as \a source for equal types)
+ * \param count   The number of values
+ */
+template <typename TTargetUnitPolicy, typename TSourceUnitPolicy, typename TSource, typename TTarget>
+void ConvertUnit(const TSource *source, TTarget *target, size_t count);
+
+/*! Convert an array of angles to another unit and wrap policy
+ *
+ * Has the same effect as assigning each angle, but without per-element
+ * temporaries. The results are wrapped according to the target wrap policy.
+ *
+ * \param source  The angles to convert
+ * \param target  The output array for the converted angles
+ * \param count   The number of angles
+ */
+template <typename TSourceElement, typename TSourceUnitPolicy, typename TSourceAutoWrapPolicy, typename TTargetElement, typename TTargetUnitPolicy, typename TTargetAutoWrapPolicy>
+void ConvertUnit(const tAngle<TSourceElement, TSourceUnitPolicy, TSourceAutoWrapPolicy> *source, tAngle<TTargetElement, TTargetUnitPolicy, TTargetAutoWrapPolicy> *target, size_t count);
+
+/*! Sine and cosine of an array of values in radians
+ *
+ * The trigonometry policy allows to select a faster approximation, e.g.
+ * SinCos<angle::Polynomial<7>>(radians, sine, cosine, count).
+ *
+ * \param radians  The input angles in radians
+ * \param sine     The output array for the sine values
+ * \param cosine   The output array for the cosine values
+ * \param count    The number of values
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename T>
+void SinCos(const T *radians, T *sine, T *cosine, size_t count);
+
+/*! Sine and cosine of an array of angles
+ *
+ * \param angles  The input angles
+ * \param sine    The output array for the sine values
+ * \param cosine  The output array for the cosine values
+ * \param count   The number of angles
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void SinCos(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *sine, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *cosine, size_t count);
+
+/*! Differences of two arrays of raw angle values in the mathematically positive direction
+ *
+ * Batch counterpart of GetAngleInbetween: difference[i] is second[i] - first[i],
+ * wrapped to the unsigned circle.
+ *
+ * \param first       The first angles
+ * \param second      The second angles
+ * \param difference  The output array for the differences (may be the same as \a first or \a second)
+ * \param count       The number of values
+ */
+template <typename TUnitPolicy = angle::Radian, typename T>
+void Difference(const T *first, const T *second, T *difference, size_t count);
+
+/*! Differences of two arrays of angles in the mathematically positive direction
+ *
+ * \param first       The first angles
+ * \param second      The second angles
+ * \param difference  The output array for the differences
+ * \param count       The number of angles
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Difference(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, tAngle<TElement, TUnitPolicy, angle::Unsigned> *difference, size_t count);
+
+/*! Shortest-path differences of two arrays of raw angle values
+ *
+ * difference[i] is the rotation of least magnitude from first[i] to second[i],
+ * i.e. second[i] - first[i] wrapped to the signed circle.
+ *
+ * \param first       The first angles
+ * \param second      The second angles
+ * \param difference  The output array for the differences (may be the same as \a first or \a second)
+ * \param count       The number of values
+ */
+template <typename TUnitPolicy = angle::Radian, typename T>
+void ShortestDifference(const T *first, const T *second, T *difference, size_t count);
+
+/*! Shortest-path differences of two arrays of angles
+ *
+ * \param first       The first angles
+ * \param second      The second angles
+ * \param difference  The output array for the differences
+ * \param count       The number of angles
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void ShortestDifference(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, tAngle<TElement, TUnitPolicy, angle::Signed> *difference, size_t count);
+
+/*! Interpolation between two angles along the shorter arc
+ *
+ * The one-dimensional counterpart of the quaternion Slerp: the result
+ * moves with constant angular velocity over \a factor and never crosses
+ * the long way around the circle, e.g. from 170 deg to -170 deg via 180 deg.
+ *
+ * \param first    The angle for \a factor = 0
+ * \param second   The angle for \a factor = 1
+ * \param factor   The interpolation parameter in [0, 1]
+ *
+ * \return The interpolated angle, wrapped according to its wrap policy
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &second, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint factor);
+
+/*! Interpolation of arrays of angles element-wise with a common factor
+ *
+ * \see Slerp
+ *
+ * \param result   The interpolated angles (may be the same memory as one of the inputs)
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint factor, tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *result, size_t count);
+
+/*! Interpolation of arrays of angles element-wise with individual factors
+ *
+ * Used for resampling: \a first and \a second hold the neighbouring
+ * samples and \a factors the positions between them.
+ *
+ * \see Slerp
+ *
+ * \param result   The interpolated angles (may be the same memory as one of the inputs)
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, const typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *factors, tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *result, size_t count);
+
+/*! Unwrap a sequence of angles into a continuous one
+ *
+ * Each step between consecutive samples is replaced by the shortest
+ * rotation, so jumps at the wrapping boundary disappear and the result can
+ * be differentiated or integrated. The first unwrapped value equals the
+ * first input value. Runs in one pass without allocation.
+ *
+ * As the values grow without bound, the unwrapped angles should have a
+ * floating point element type.
+ *
+ * \param wrapped     The wrapped angles
+ * \param unwrapped   The output array for the unwrapped angles (may be the same memory as \a wrapped for equal element types)
+ * \param count       The number of angles
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy, typename TUnwrappedElement>
+void Unwrap(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *wrapped, tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> *unwrapped, size_t count);
+
+/*! Continue unwrapping a sequence that arrives in chunks
+ *
+ * Passing the last unwrapped angle of the previous chunk as \a previous
+ * gives the same result as unwrapping the whole sequence at once.
+ *
+ * \param wrapped     The wrapped angles of the current chunk
+ * \param unwrapped   The output array for the unwrapped angles
+ * \param count       The number of angles
+ * \param previous    The last unwrapped angle of the previous chunk
+ */
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy, typename TUnwrappedElement>
+void Unwrap(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *wrapped, tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> *unwrapped, size_t count, const tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> &previous);
+
 /*!
  * \brief Test if an angle is inbetween two other angles (in the mathematically positive direction)
  *
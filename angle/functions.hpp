@@ -42,7 +42,9 @@
 // External includes with <>
 //----------------------------------------------------------------------
 #include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <type_traits>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -68,37 +70,363 @@ namespace math
 //----------------------------------------------------------------------
 // ArcSine
 //----------------------------------------------------------------------
-template <typename T>
+template <typename TTrigonometryPolicy, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ASin(T sine)
 {
-  return tAngle<T, angle::Radian, angle::NoWrap>(std::asin(sine));
+  return tAngle<T, angle::Radian, angle::NoWrap>(TTrigonometryPolicy::ASin(sine));
 }
 
 //----------------------------------------------------------------------
 // ArcCosine
 //----------------------------------------------------------------------
-template <typename T>
+template <typename TTrigonometryPolicy, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ACos(T cosine)
 {
-  return tAngle<T, angle::Radian, angle::NoWrap>(std::acos(cosine));
+  return tAngle<T, angle::Radian, angle::NoWrap>(TTrigonometryPolicy::ACos(cosine));
 }
 
 //----------------------------------------------------------------------
 // ArcTangent
 //----------------------------------------------------------------------
-template <typename T>
+template <typename TTrigonometryPolicy, typename T>
 tAngle<T, angle::Radian, angle::NoWrap> ATan(T tangent)
 {
-  return tAngle<T, angle::Radian, angle::NoWrap>(std::atan(tangent));
+  return tAngle<T, angle::Radian, angle::NoWrap>(TTrigonometryPolicy::ATan(tangent));
 }
 
 //----------------------------------------------------------------------
 // ArcTangent2
 //----------------------------------------------------------------------
-template <typename TY, typename TX>
+template <typename TTrigonometryPolicy, typename TY, typename TX>
 tAngle < decltype(TY() + TX()), angle::Radian, angle::NoWrap > ATan2(TY y, TX x)
 {
-  return tAngle < decltype(TY() + TX()), angle::Radian, angle::NoWrap > (std::atan2(y, x));
+  typedef decltype(TY() + TX()) tElement;
+  return tAngle<tElement, angle::Radian, angle::NoWrap>(TTrigonometryPolicy::ATan2(static_cast<tElement>(y), static_cast<tElement>(x)));
+}
+
+//----------------------------------------------------------------------
+// ArcSine (array)
+//----------------------------------------------------------------------
+template <typename TTrigonometryPolicy, typename T>
+void ASin(const T *sine, T *radians, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    radians[i] = TTrigonometryPolicy::ASin(sine[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// ArcCosine (array)
+//----------------------------------------------------------------------
+template <typename TTrigonometryPolicy, typename T>
+void ACos(const T *cosine, T *radians, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    radians[i] = TTrigonometryPolicy::ACos(cosine[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// ArcTangent (array)
+//----------------------------------------------------------------------
+template <typename TTrigonometryPolicy, typename T>
+void ATan(const T *tangent, T *radians, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    radians[i] = TTrigonometryPolicy::ATan(tangent[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// ArcTangent2 (array)
+//----------------------------------------------------------------------
+template <typename TTrigonometryPolicy, typename T>
+void ATan2(const T *y, const T *x, T *radians, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    radians[i] = TTrigonometryPolicy::ATan2(y[i], x[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// Internal values of angle arrays
+//----------------------------------------------------------------------
+// tAngle consists of nothing but its value, so arrays of angles can be
+// processed as arrays of their values without per-element temporaries
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+inline TElement *GetValues(tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles)
+{
+  static_assert(sizeof(tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>) == sizeof(TElement), "tAngle must have the same layout as its element type");
+  return reinterpret_cast<TElement *>(angles);
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+inline const TElement *GetValues(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles)
+{
+  static_assert(sizeof(tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>) == sizeof(TElement), "tAngle must have the same layout as its element type");
+  return reinterpret_cast<const TElement *>(angles);
+}
+
+//----------------------------------------------------------------------
+// Wrapping of single floating point values
+//----------------------------------------------------------------------
+// Same computation as in tAngle::WrapSigned and tAngle::WrapUnsigned, but
+// without the detour through double, so that loops over float values
+// vectorize with twice the width
+template <typename TUnitPolicy, typename T>
+inline T GetWrappedSigned(T value)
+{
+  const T range = TUnitPolicy::FullRotation();
+  const T half_range = range / 2;
+  T wrapped = value - range * std::floor((value + half_range) / range);
+  return wrapped >= half_range ? wrapped - range : wrapped;
+}
+
+template <typename TUnitPolicy, typename T>
+inline T GetWrappedUnsigned(T value)
+{
+  const T range = TUnitPolicy::FullRotation();
+  T wrapped = value - range * std::floor(value / range);
+  return wrapped >= range ? wrapped - range : wrapped;
+}
+
+template <typename TUnitPolicy, typename TAutoWrapPolicy, typename T>
+inline T GetWrapped(T value)
+{
+  return std::is_same<TAutoWrapPolicy, angle::Signed>::value ? GetWrappedSigned<TUnitPolicy>(value) :
+         std::is_same<TAutoWrapPolicy, angle::Unsigned>::value ? GetWrappedUnsigned<TUnitPolicy>(value) : value;
+}
+
+// Converts a floating point result back to the element type of an angle.
+// Integral elements (binary angles) are rounded and wrap modulo their range
+template <typename TElement, typename T>
+inline TElement GetElement(T value)
+{
+  return std::is_integral<TElement>::value ? static_cast<TElement>(static_cast<std::int64_t>(std::floor(value + T(0.5)))) : static_cast<TElement>(value);
+}
+
+//----------------------------------------------------------------------
+// WrapSigned (array)
+//----------------------------------------------------------------------
+template <typename TUnitPolicy, typename T>
+void WrapSigned(T *values, size_t count)
+{
+  typedef typename std::conditional<std::is_floating_point<T>::value, T, double>::type tFloatingPoint;
+  for (size_t i = 0; i < count; ++i)
+  {
+    values[i] = GetElement<T>(GetWrappedSigned<TUnitPolicy>(static_cast<tFloatingPoint>(values[i])));
+  }
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void WrapSigned(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, tAngle<TElement, TUnitPolicy, angle::Signed> *wrapped, size_t count)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+  const TElement *values = GetValues(angles);
+  TElement *wrapped_values = GetValues(wrapped);
+  for (size_t i = 0; i < count; ++i)
+  {
+    wrapped_values[i] = GetElement<TElement>(GetWrappedSigned<TUnitPolicy>(static_cast<tFloatingPoint>(values[i])));
+  }
+}
+
+//----------------------------------------------------------------------
+// WrapUnsigned (array)
+//----------------------------------------------------------------------
+template <typename TUnitPolicy, typename T>
+void WrapUnsigned(T *values, size_t count)
+{
+  typedef typename std::conditional<std::is_floating_point<T>::value, T, double>::type tFloatingPoint;
+  for (size_t i = 0; i < count; ++i)
+  {
+    values[i] = GetElement<T>(GetWrappedUnsigned<TUnitPolicy>(static_cast<tFloatingPoint>(values[i])));
+  }
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void WrapUnsigned(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, tAngle<TElement, TUnitPolicy, angle::Unsigned> *wrapped, size_t count)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+  const TElement *values = GetValues(angles);
+  TElement *wrapped_values = GetValues(wrapped);
+  for (size_t i = 0; i < count; ++i)
+  {
+    wrapped_values[i] = GetElement<TElement>(GetWrappedUnsigned<TUnitPolicy>(static_cast<tFloatingPoint>(values[i])));
+  }
+}
+
+//----------------------------------------------------------------------
+// ConvertUnit (array)
+//----------------------------------------------------------------------
+template <typename TTargetUnitPolicy, typename TSourceUnitPolicy, typename TSource, typename TTarget>
+void ConvertUnit(const TSource *source, TTarget *target, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    target[i] = static_cast<TTarget>(TTargetUnitPolicy::ConvertFromUnit(source[i], TSourceUnitPolicy()));
+  }
+}
+
+template <typename TSourceElement, typename TSourceUnitPolicy, typename TSourceAutoWrapPolicy, typename TTargetElement, typename TTargetUnitPolicy, typename TTargetAutoWrapPolicy>
+void ConvertUnit(const tAngle<TSourceElement, TSourceUnitPolicy, TSourceAutoWrapPolicy> *source, tAngle<TTargetElement, TTargetUnitPolicy, TTargetAutoWrapPolicy> *target, size_t count)
+{
+  typedef decltype(TSourceElement() + TTargetElement()) tElement;
+
+  const TSourceElement *source_values = GetValues(source);
+  TTargetElement *target_values = GetValues(target);
+  for (size_t i = 0; i < count; ++i)
+  {
+    target_values[i] = static_cast<TTargetElement>(TTargetUnitPolicy::ConvertFromUnit(static_cast<tElement>(source_values[i]), TSourceUnitPolicy()));
+  }
+
+  if (std::is_same<TTargetAutoWrapPolicy, angle::Signed>::value)
+  {
+    WrapSigned<TTargetUnitPolicy>(target_values, count);
+  }
+  else if (std::is_same<TTargetAutoWrapPolicy, angle::Unsigned>::value)
+  {
+    WrapUnsigned<TTargetUnitPolicy>(target_values, count);
+  }
+}
+
+//----------------------------------------------------------------------
+// SinCos (array)
+//----------------------------------------------------------------------
+template <typename TTrigonometryPolicy, typename T>
+void SinCos(const T *radians, T *sine, T *cosine, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    TTrigonometryPolicy::SinCos(radians[i], sine[i], cosine[i]);
+  }
+}
+
+template <typename TTrigonometryPolicy, typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void SinCos(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *angles, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *sine, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *cosine, size_t count)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+
+  const TElement *values = GetValues(angles);
+  for (size_t i = 0; i < count; ++i)
+  {
+    TTrigonometryPolicy::SinCos(angle::Radian::ConvertFromUnit(static_cast<tFloatingPoint>(values[i]), TUnitPolicy()), sine[i], cosine[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// Difference (array)
+//----------------------------------------------------------------------
+template <typename TUnitPolicy, typename T>
+void Difference(const T *first, const T *second, T *difference, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    difference[i] = second[i] - first[i];
+  }
+  WrapUnsigned<TUnitPolicy>(difference, count);
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Difference(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, tAngle<TElement, TUnitPolicy, angle::Unsigned> *difference, size_t count)
+{
+  Difference<TUnitPolicy>(GetValues(first), GetValues(second), GetValues(difference), count);
+}
+
+//----------------------------------------------------------------------
+// ShortestDifference (array)
+//----------------------------------------------------------------------
+template <typename TUnitPolicy, typename T>
+void ShortestDifference(const T *first, const T *second, T *difference, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    difference[i] = second[i] - first[i];
+  }
+  WrapSigned<TUnitPolicy>(difference, count);
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void ShortestDifference(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, tAngle<TElement, TUnitPolicy, angle::Signed> *difference, size_t count)
+{
+  ShortestDifference<TUnitPolicy>(GetValues(first), GetValues(second), GetValues(difference), count);
+}
+
+//----------------------------------------------------------------------
+// Slerp
+//----------------------------------------------------------------------
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &second, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint factor)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+  tFloatingPoint start = first.Value();
+  return tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>(GetElement<TElement>(start + factor * GetWrappedSigned<TUnitPolicy>(second.Value() - start)));
+}
+
+//----------------------------------------------------------------------
+// Slerp (array)
+//----------------------------------------------------------------------
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint factor, tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *result, size_t count)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+
+  const TElement *first_values = GetValues(first);
+  const TElement *second_values = GetValues(second);
+  TElement *result_values = GetValues(result);
+  for (size_t i = 0; i < count; ++i)
+  {
+    tFloatingPoint start = first_values[i];
+    tFloatingPoint value = start + factor * GetWrappedSigned<TUnitPolicy>(second_values[i] - start);
+    result_values[i] = GetElement<TElement>(GetWrapped<TUnitPolicy, TAutoWrapPolicy>(value));
+  }
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void Slerp(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *first, const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *second, const typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint *factors, tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *result, size_t count)
+{
+  typedef typename tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+
+  const TElement *first_values = GetValues(first);
+  const TElement *second_values = GetValues(second);
+  TElement *result_values = GetValues(result);
+  for (size_t i = 0; i < count; ++i)
+  {
+    tFloatingPoint start = first_values[i];
+    tFloatingPoint value = start + factors[i] * GetWrappedSigned<TUnitPolicy>(second_values[i] - start);
+    result_values[i] = GetElement<TElement>(GetWrapped<TUnitPolicy, TAutoWrapPolicy>(value));
+  }
+}
+
+//----------------------------------------------------------------------
+// Unwrap
+//----------------------------------------------------------------------
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy, typename TUnwrappedElement>
+void Unwrap(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *wrapped, tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> *unwrapped, size_t count)
+{
+  if (count > 0)
+  {
+    Unwrap(wrapped, unwrapped, count, tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap>(static_cast<TUnwrappedElement>(wrapped[0].Value())));
+  }
+}
+
+template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy, typename TUnwrappedElement>
+void Unwrap(const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> *wrapped, tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> *unwrapped, size_t count, const tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap> &previous)
+{
+  typedef typename tAngle<TUnwrappedElement, TUnitPolicy, angle::NoWrap>::tFloatingPoint tFloatingPoint;
+
+  const TElement *wrapped_values = GetValues(wrapped);
+  TUnwrappedElement *unwrapped_values = GetValues(unwrapped);
+  tFloatingPoint current = previous.Value();
+  for (size_t i = 0; i < count; ++i)
+  {
+    // the step is taken relative to the unwrapped value, so rounding errors do not accumulate
+    current += GetWrappedSigned<TUnitPolicy>(static_cast<tFloatingPoint>(wrapped_values[i]) - current);
+    unwrapped_values[i] = GetElement<TUnwrappedElement>(current);
+  }
 }
 
 template <template <typename, typename, typename> class TAngle, typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
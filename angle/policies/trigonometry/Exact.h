@@ -0,0 +1,132 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/angle/policies/trigonometry/Exact.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief
+ *
+ * \b
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__angle__include_guard__
+#error Invalid include directive. Try #include "rrlib/math/tAngle.h" instead.
+#endif
+
+#ifndef __rrlib__math__angle__policies__trigonometry__Exact_h__
+#define __rrlib__math__angle__policies__trigonometry__Exact_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace angle
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Trigonometry policy that uses the functions from the standard library
+/*!
+ * This is the default policy for tAngle::Sine, tAngle::Cosine,
+ * tAngle::SinCos and the inverse functions ASin, ACos, ATan and ATan2
+ * and yields full machine precision.
+ */
+struct Exact
+{
+  template <typename T>
+  static inline T Sine(T radians)
+  {
+    return std::sin(radians);
+  }
+
+  template <typename T>
+  static inline T Cosine(T radians)
+  {
+    return std::cos(radians);
+  }
+
+  template <typename T>
+  static inline void SinCos(T radians, T &sine, T &cosine)
+  {
+    sine = std::sin(radians);
+    cosine = std::cos(radians);
+  }
+
+  template <typename T>
+  static inline T ASin(T sine)
+  {
+    return std::asin(sine);
+  }
+
+  template <typename T>
+  static inline T ACos(T cosine)
+  {
+    return std::acos(cosine);
+  }
+
+  template <typename T>
+  static inline T ATan(T tangent)
+  {
+    return std::atan(tangent);
+  }
+
+  template <typename T>
+  static inline T ATan2(T y, T x)
+  {
+    return std::atan2(y, x);
+  }
+};
+
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
@@ -0,0 +1,252 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/angle/policies/trigonometry/Polynomial.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief
+ *
+ * \b
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__angle__include_guard__
+#error Invalid include directive. Try #include "rrlib/math/tAngle.h" instead.
+#endif
+
+#ifndef __rrlib__math__angle__policies__trigonometry__Polynomial_h__
+#define __rrlib__math__angle__policies__trigonometry__Polynomial_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <type_traits>
+#include <algorithm>
+#include <limits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace angle
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Trigonometry policy using minimax polynomials
+/*!
+ * The argument is reduced to [-pi/4, pi/4] by subtracting the nearest
+ * multiple of pi/2 (Cody-Waite, in double precision) and sine and cosine
+ * of the remainder are approximated by polynomials. The quadrant then
+ * selects the signs and whether sine and cosine are swapped.
+ *
+ * The inverse functions are based on an arc tangent of the ratio
+ * min(|y|, |x|) / max(|y|, |x|) in [0, 1], which is further reduced by
+ * atan(t) = pi/4 + atan((t - 1) / (t + 1)). All case distinctions are
+ * plain selects, so loops over arrays can be vectorized by the compiler.
+ * Like std::atan2, NaN propagates and the sign of zero selects the
+ * half-plane, e.g. ATan2(0.0, -0.0) is pi.
+ * ASin and ACos use atan2 with sqrt((1 - v)(1 + v)).
+ *
+ * \a Tdigits selects the accuracy level:
+ *   4  - absolute error below 1e-5 (degree 5 for sine and arc tangent, degree 4 for cosine)
+ *   7  - absolute error below 3e-8 (degree 7 for sine, degree 6 for cosine, degree 9 for arc tangent)
+ *   16 - full double precision (polynomials and rational function from the Cephes library)
+ *
+ * The error bounds hold for arguments up to some 1e5 radians. Beyond that,
+ * the argument reduction loses accuracy and the standard library should
+ * be used.
+ */
+template <unsigned int Tdigits = 7>
+struct Polynomial
+{
+  static_assert(Tdigits == 4 || Tdigits == 7 || Tdigits == 16, "Supported accuracy levels are 4, 7 and 16 digits");
+
+  template <typename T>
+  static inline T Sine(T radians)
+  {
+    T sine, cosine;
+    SinCos(radians, sine, cosine);
+    return sine;
+  }
+
+  template <typename T>
+  static inline T Cosine(T radians)
+  {
+    T sine, cosine;
+    SinCos(radians, sine, cosine);
+    return cosine;
+  }
+
+  template <typename T>
+  static inline void SinCos(T radians, T &sine, T &cosine)
+  {
+    const double cPI_2_HIGH = 1.57079632673412561417e+00;
+    const double cPI_2_LOW = 6.07710050650619224932e-11;
+
+    double k = std::floor(radians * M_2_PI + 0.5);
+    T r = static_cast<T>((radians - k * cPI_2_HIGH) - k * cPI_2_LOW);
+    T s, c;
+    Approximate(r, s, c, std::integral_constant<unsigned int, Tdigits>());
+
+    // quadrant selection without branches, so that loops over SinCos vectorize
+    int quadrant = static_cast<int>(k) & 3;
+    bool swap = quadrant & 1;
+    sine = (swap ? c : s) * T(1 - (quadrant & 2));
+    cosine = (swap ? s : c) * T(1 - ((quadrant + 1) & 2));
+  }
+
+  template <typename T>
+  static inline T ASin(T sine)
+  {
+    return ATan2(sine, static_cast<T>(std::sqrt((1 - sine) * (1 + sine))));
+  }
+
+  template <typename T>
+  static inline T ACos(T cosine)
+  {
+    return ATan2(static_cast<T>(std::sqrt((1 - cosine) * (1 + cosine))), cosine);
+  }
+
+  template <typename T>
+  static inline T ATan(T tangent)
+  {
+    return ATan2(tangent, T(1));
+  }
+
+  template <typename T>
+  static inline T ATan2(T y, T x)
+  {
+    T abs_x = std::fabs(x);
+    T abs_y = std::fabs(y);
+    T minimum = std::min(abs_x, abs_y);
+    T maximum = std::max(abs_x, abs_y);
+    // std::min and std::max drop NaN, so it is put back into the ratio.
+    // Equal values (also both infinite) yield exactly one
+    bool is_nan = x != x || y != y;
+    T ratio = maximum > 0 ? (minimum == maximum ? T(1) : minimum / maximum) : T(0);
+    ratio = is_nan ? std::numeric_limits<T>::quiet_NaN() : ratio;
+
+    T result = ATanOfRatio(ratio, std::integral_constant<unsigned int, Tdigits>());
+    result = abs_y > abs_x ? T(M_PI_2) - result : result;
+    // the sign of x also counts for zero; std::signbit keeps GCC from vectorizing double loops
+    result = std::copysign(T(1), x) < 0 ? T(M_PI) - result : result;
+    return std::copysign(result, y);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  template <typename T>
+  static inline void Approximate(T r, T &sine, T &cosine, std::integral_constant<unsigned int, 4>)
+  {
+    T z = r * r;
+    sine = r * (T(0.9999983854024038) + z * (T(-0.16661749354366243) + z * T(0.008136511962309604)));
+    cosine = T(0.9999900349553448) + z * (T(-0.49970814035693445) + z * T(0.04039853596906776));
+  }
+
+  template <typename T>
+  static inline void Approximate(T r, T &sine, T &cosine, std::integral_constant<unsigned int, 7>)
+  {
+    T z = r * r;
+    sine = r * (T(0.9999999861793425) + z * (T(-0.16666636754300287) + z * (T(0.008331584606514487) + z * T(-0.00019462117000783503))));
+    cosine = T(0.9999999724233232) + z * (T(-0.49999856695849865) + z * (T(0.04165502688429943) + z * T(-0.0013585908510622608)));
+  }
+
+  template <typename T>
+  static inline void Approximate(T r, T &sine, T &cosine, std::integral_constant<unsigned int, 16>)
+  {
+    T z = r * r;
+    sine = r + r * z * (T(-1.66666666666666307295E-1) + z * (T(8.33333333332211858878E-3) + z * (T(-1.98412698295895385996E-4) +
+                        z * (T(2.75573136213857245213E-6) + z * (T(-2.50507477628578072866E-8) + z * T(1.58962301576546568060E-10))))));
+    cosine = T(1) - T(0.5) * z + z * z * (T(4.16666666666665929218E-2) + z * (T(-1.38888888888730564116E-3) + z * (T(2.48015872888517045348E-5) +
+                                          z * (T(-2.75573141792967388112E-7) + z * (T(2.08757008419747316778E-9) + z * T(-1.13585365213876817300E-11))))));
+  }
+
+  template <typename T, unsigned int Tlevel>
+  static inline T ATanOfRatio(T ratio, std::integral_constant<unsigned int, Tlevel> level)
+  {
+    const T cREDUCTION_THRESHOLD = Tlevel == 16 ? T(0.66) : T(0.41421356237309503);
+    bool reduce = ratio > cREDUCTION_THRESHOLD;
+    T t = reduce ? (ratio - 1) / (ratio + 1) : ratio;
+    T result = ApproximateATan(t, level);
+    return reduce ? result + T(M_PI_4) : result;
+  }
+
+  template <typename T>
+  static inline T ApproximateATan(T t, std::integral_constant<unsigned int, 4>)
+  {
+    T z = t * t;
+    return t * (T(0.9999793236723695) + z * (T(-0.33105450211862714) + z * T(0.1657796783973559)));
+  }
+
+  template <typename T>
+  static inline T ApproximateATan(T t, std::integral_constant<unsigned int, 7>)
+  {
+    T z = t * t;
+    return t * (T(0.9999999962748032) + z * (T(-0.33333066830999486) + z * (T(0.19981261918604848) +
+                                        z * (T(-0.13905181842186784) + z * T(0.08114848417192005)))));
+  }
+
+  template <typename T>
+  static inline T ApproximateATan(T t, std::integral_constant<unsigned int, 16>)
+  {
+    T z = t * t;
+    T p = T(-6.485021904942025371773E1) + z * (T(-1.228866684490136173410E2) + z * (T(-7.500855792314704667340E1) +
+                                               z * (T(-1.615753718733365076637E1) + z * T(-8.750608600031904122785E-1))));
+    T q = T(1.945506571482613964425E2) + z * (T(4.853903996359136964868E2) + z * (T(4.328810604912902668951E2) +
+                                              z * (T(1.650270098316988542046E2) + z * (T(2.485846490142306297962E1) + z))));
+    return t + t * z * p / q;
+  }
+};
+
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
@@ -0,0 +1,175 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/angle/policies/trigonometry/Table.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief
+ *
+ * \b
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__angle__include_guard__
+#error Invalid include directive. Try #include "rrlib/math/tAngle.h" instead.
+#endif
+
+#ifndef __rrlib__math__angle__policies__trigonometry__Table_h__
+#define __rrlib__math__angle__policies__trigonometry__Table_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace angle
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Trigonometry policy using a lookup table with linear interpolation
+/*!
+ * A table with \a Tsize samples of one full sine period is created on
+ * first use (per element type). Cosine uses the same table shifted by a
+ * quarter turn. The absolute error of the linear interpolation is bounded
+ * by (2 pi / Tsize)^2 / 8, i.e. about 3e-7 for the default size and 8e-5
+ * for 256 samples.
+ *
+ * The inverse functions do not fit into a table of moderate size and are
+ * taken from Polynomial<7>.
+ */
+template <size_t Tsize = 4096>
+struct Table
+{
+  static_assert(Tsize >= 4 && (Tsize & (Tsize - 1)) == 0, "Table size must be a power of two");
+
+  template <typename T>
+  static inline T Sine(T radians)
+  {
+    T sine, cosine;
+    SinCos(radians, sine, cosine);
+    return sine;
+  }
+
+  template <typename T>
+  static inline T Cosine(T radians)
+  {
+    T sine, cosine;
+    SinCos(radians, sine, cosine);
+    return cosine;
+  }
+
+  template <typename T>
+  static inline void SinCos(T radians, T &sine, T &cosine)
+  {
+    const T *values = Values<T>();
+
+    double position = radians * (Tsize / (2 * M_PI));
+    double index = std::floor(position);
+    T fraction = static_cast<T>(position - index);
+    size_t i = static_cast<size_t>(static_cast<long long>(index) & (Tsize - 1));
+    size_t j = (i + Tsize / 4) & (Tsize - 1);
+
+    sine = values[i] + fraction * (values[i + 1] - values[i]);
+    cosine = values[j] + fraction * (values[j + 1] - values[j]);
+  }
+
+  template <typename T>
+  static inline T ASin(T sine)
+  {
+    return Polynomial<7>::ASin(sine);
+  }
+
+  template <typename T>
+  static inline T ACos(T cosine)
+  {
+    return Polynomial<7>::ACos(cosine);
+  }
+
+  template <typename T>
+  static inline T ATan(T tangent)
+  {
+    return Polynomial<7>::ATan(tangent);
+  }
+
+  template <typename T>
+  static inline T ATan2(T y, T x)
+  {
+    return Polynomial<7>::ATan2(y, x);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  template <typename T>
+  static const T *Values()
+  {
+    static const struct tValues
+    {
+      T data[Tsize + 1];
+      tValues()
+      {
+        for (size_t i = 0; i <= Tsize; ++i)
+        {
+          data[i] = static_cast<T>(std::sin(2 * M_PI * i / Tsize));
+        }
+      }
+    } values;
+    return values.data;
+  }
+};
+
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
@@ -0,0 +1,135 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/angle/policies/unit/Binary.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief
+ *
+ * \b
+ *
+ */
+#ifndef __rrlib__math__angle__include_guard__
+#error Invalid include directive. Try #include "rrlib/math/tAngle.h" instead.
+#endif
+
+#ifndef __rrlib__math__angle__policies__unit__Binary_h__
+#define __rrlib__math__angle__policies__unit__Binary_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace angle
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+struct Radian;
+struct Degree;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Binary angle measurement: one full turn equals 2^32
+/*!
+ * Meant to be used with std::uint32_t elements and angle::NoWrap. Sums and
+ * differences then wrap for free through unsigned integer overflow and
+ * accumulating headings does not drift. Conversions into other units
+ * yield values in [0, 1 circle) before the wrap policy of the target is
+ * applied.
+ *
+ * \note Scaling a binary angle by a floating point factor is only defined
+ *       as long as the result stays within one turn
+ */
+struct Binary
+{
+
+  static inline double FullRotation()
+  {
+    return 4294967296.0;
+  }
+
+  static inline const char *UnitString()
+  {
+    return "bam";
+  }
+
+  template <typename T>
+  static inline std::uint32_t ConvertFromUnit(T value, const Radian &)
+  {
+    return FromTurns(value / (2 * M_PI));
+  }
+
+  template <typename T>
+  static inline std::uint32_t ConvertFromUnit(T value, const Degree &)
+  {
+    return FromTurns(value / 360.0);
+  }
+
+  template <typename T>
+  static inline T ConvertFromUnit(T value, const Binary &)
+  {
+    return value;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static inline std::uint32_t FromTurns(double turns)
+  {
+    // unsigned conversions are modular, so negative values and multiple turns wrap correctly
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(turns * 4294967296.0 + 0.5))));
+  }
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
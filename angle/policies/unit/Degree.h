@@ -65,6 +65,7 @@ namespace angle
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 struct Radian;
+struct Binary;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -98,6 +99,12 @@ struct Degree
     return value;
   }
 
+  template <typename T>
+  static inline double ConvertFromUnit(T value, const Binary &)
+  {
+    return value * (360.0 / 4294967296.0);
+  }
+
 };
 
 //----------------------------------------------------------------------
@@ -65,6 +65,7 @@ namespace angle
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 struct Degree;
+struct Binary;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -98,6 +99,12 @@ struct Radian
     return value * M_PI / 180.0;
   }
 
+  template <typename T>
+  static inline double ConvertFromUnit(T value, const Binary &)
+  {
+    return value * (2 * M_PI / 4294967296.0);
+  }
+
 };
 
 //----------------------------------------------------------------------
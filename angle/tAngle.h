@@ -50,6 +50,7 @@
 #include <type_traits>
 #include <stdexcept>
 #include <cstring>
+#include <cmath>
 
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 #include "rrlib/serialization/serialization.h"
@@ -114,14 +115,16 @@ public:
 
   typedef TElement tElement;
 
+  /*! The type used for sine, cosine and tangent (\a TElement unless that is integral like for binary angles) */
+  typedef typename std::conditional<std::is_floating_point<TElement>::value, TElement, double>::type tFloatingPoint;
+
   /*! Default ctor of tAngle
    *
    * Initializes with zero
    */
   inline tAngle()
-  {
-    std::memset(this, 0, sizeof(tAngle));
-  }
+    : value(0)
+  {}
 
   /*! Conversion from raw value
    *
@@ -134,14 +137,14 @@ public:
   }
 
   /*! Copy ctor of tAngle (same type)
+   *
+   * The value of \a other already satisfies the wrap policy and is copied
+   * as is. Together with the defaulted assignment this keeps tAngle
+   * trivially copyable, e.g. for memmove in std::vector.
    *
    * \param other   Another angle of same type
    */
-  inline tAngle(const tAngle &other)
-    : value(other.value)
-  {
-    TAutoWrapPolicy::Wrap(*this);
-  }
+  tAngle(const tAngle &other) = default;
 
   /*! Copy ctor of tAngle (with conversion from other specializations)
    *
@@ -149,9 +152,13 @@ public:
    */
   template <typename TOtherElement, typename TOtherUnitPolicy, typename TOtherAutoWrapPolicy>
   inline tAngle(const tAngle<TOtherElement, TOtherUnitPolicy, TOtherAutoWrapPolicy> &other)
-    : value(TUnitPolicy::ConvertFromUnit(static_cast<TElement>(other.Value()), TOtherUnitPolicy()))
+    : value(static_cast<TElement>(TUnitPolicy::ConvertFromUnit(static_cast<decltype(TElement() + TOtherElement())>(other.Value()), TOtherUnitPolicy())))
   {
-    TAutoWrapPolicy::Wrap(*this);
+    // only widening the element type keeps an already wrapped value in range
+    if (!std::is_same<TUnitPolicy, TOtherUnitPolicy>::value || !std::is_same<TAutoWrapPolicy, TOtherAutoWrapPolicy>::value || sizeof(TElement) < sizeof(TOtherElement))
+    {
+      TAutoWrapPolicy::Wrap(*this);
+    }
   }
 
   /*! Assignment operator (same type)
@@ -160,11 +167,7 @@ public:
    *
    * \return \a this angle
    */
-  inline tAngle &operator = (const tAngle &other)
-  {
-    this->value = other.value;
-    return *this;
-  }
+  tAngle &operator = (const tAngle &other) = default;
 
   /*! Assignment operator (with conversion from other specializations)
    *
@@ -256,24 +259,30 @@ public:
 
   /*! The sine of this angle
    *
-   * Calculates the sine taking into account the current representation
+   * Calculates the sine taking into account the current representation.
+   * The trigonometry policy selects between the standard library
+   * (angle::Exact) and faster approximations like angle::Polynomial<4>
+   * or angle::Table<>, e.g. angle.Sine<angle::Polynomial<7>>().
    *
    * \return The sine of \a this angle
    */
-  inline TElement Sine() const
+  template <typename TTrigonometryPolicy = typename angle::DefaultTrigonometryPolicy<TUnitPolicy>::tType>
+  inline tFloatingPoint Sine() const
   {
-    return std::sin(tAngle<TElement, angle::Radian>(*this).Value());
+    return TTrigonometryPolicy::Sine(this->Radians());
   }
 
   /*! The cosine of this angle
    *
    * Calculates the cosine taking into account the current representation
+   * using the given trigonometry policy
    *
    * \return The cosine of \a this angle
    */
-  inline TElement Cosine() const
+  template <typename TTrigonometryPolicy = typename angle::DefaultTrigonometryPolicy<TUnitPolicy>::tType>
+  inline tFloatingPoint Cosine() const
   {
-    return std::cos(tAngle<TElement, angle::Radian>(*this).Value());
+    return TTrigonometryPolicy::Cosine(this->Radians());
   }
 
   /*! The tangent of this angle
@@ -282,24 +291,26 @@ public:
    *
    * \return The tangent of \a this angle
    */
-  inline TElement Tangent() const
+  inline tFloatingPoint Tangent() const
   {
-    return std::tan(tAngle<TElement, angle::Radian>(*this).Value());
+    return std::tan(this->Radians());
   }
 
   /*! Optimized version to calculate sine and cosine at once
    *
-   * Sine and cosine are often used together. Calling this method avoids an extra conversion.
+   * Sine and cosine are often used together. Calling this method avoids an extra conversion
+   * and lets approximating trigonometry policies share the argument reduction.
    *
    * \param sine     The variable the sine value will be stored in
    * \param cosine   The variable the cosine value will be stored in
    */
-  template <typename T>
+  template <typename TTrigonometryPolicy = typename angle::DefaultTrigonometryPolicy<TUnitPolicy>::tType, typename T>
   inline void SinCos(T &sine, T &cosine) const
   {
-    TElement value = tAngle<TElement, angle::Radian>(*this).Value();
-    sine = std::sin(value);
-    cosine = std::cos(value);
+    tFloatingPoint s, c;
+    TTrigonometryPolicy::SinCos(this->Radians(), s, c);
+    sine = s;
+    cosine = c;
   }
 
   /*! Wrap the internal value to the signed circle
@@ -307,13 +318,18 @@ public:
    * After calling this method, the internal value will be within
    * the half-open interval [-1/2 circle, 1/2 circle), representing the
    * same direction as before.
+   *
+   * The wrapping is branch-free and exact up to rounding as long as the
+   * value is within a few turns of the range. For values far away from
+   * it, the error grows with their magnitude.
    */
   inline void WrapSigned()
   {
     double range = TUnitPolicy::FullRotation();
-
     double half_range = range / 2;
-    this->value = Modulo(this->value + half_range, range) - half_range;
+
+    double value = this->value - range * std::floor((this->value + half_range) / range);
+    this->value = value >= half_range ? value - range : value;
   }
 
   /*! Get the wrapped signed internal value without changing the object
@@ -335,11 +351,15 @@ public:
    * After calling this method, the internal value will be within
    * the half-open interval [0, 1 circle), representing the
    * same direction as before.
+   *
+   * The wrapping is branch-free, see WrapSigned.
    */
   inline void WrapUnsigned()
   {
     double range = TUnitPolicy::FullRotation();
-    this->value = Modulo<double>(this->value, range);
+
+    double value = this->value - range * std::floor(this->value / range);
+    this->value = value >= range ? value - range : value;
   }
 
   /*! Get the wrapped unsigned internal value without changing the object
@@ -374,6 +394,11 @@ private:
 
   TElement value;
 
+  inline tFloatingPoint Radians() const
+  {
+    return angle::Radian::ConvertFromUnit(static_cast<tFloatingPoint>(this->value), TUnitPolicy());
+  }
+
 };
 
 //----------------------------------------------------------------------
@@ -387,9 +412,9 @@ private:
  * \return -\a angle
  */
 template <typename TElement, typename TUnitPolicy, typename TAutoWrapPolicy>
-inline tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> operator - (tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> angle)
+inline tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> operator - (const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &angle)
 {
-  return tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>(-static_cast<double>(angle));
+  return tAngle<TElement, TUnitPolicy, TAutoWrapPolicy>(-angle.Value());
 }
 
 /*! Addition
@@ -529,7 +554,7 @@ bool operator != (const tAngle<TElement, TUnitPolicy, TAutoWrapPolicy> &left, co
 template <typename TLeftElement, typename TRightElement, typename TLeftUnitPolicy, typename TRightUnitPolicy, typename TAutoWrapPolicy>
 bool operator < (const tAngle<TLeftElement, TLeftUnitPolicy, TAutoWrapPolicy> &left, const tAngle<TRightElement, TRightUnitPolicy, TAutoWrapPolicy> &right)
 {
-  return left.Value() < tAngle<TLeftElement, TLeftUnitPolicy, TAutoWrapPolicy>(right).Value();
+  return left.Value() < static_cast<TLeftElement>(TLeftUnitPolicy::ConvertFromUnit(static_cast<decltype(TLeftElement() + TRightElement())>(right.Value()), TRightUnitPolicy()));
 }
 
 /*! Greater-than
@@ -542,7 +567,7 @@ bool operator < (const tAngle<TLeftElement, TLeftUnitPolicy, TAutoWrapPolicy> &l
 template <typename TLeftElement, typename TRightElement, typename TLeftUnitPolicy, typename TRightUnitPolicy, typename TAutoWrapPolicy>
 bool operator > (const tAngle<TLeftElement, TLeftUnitPolicy, TAutoWrapPolicy> &left, const tAngle<TRightElement, TRightUnitPolicy, TAutoWrapPolicy> &right)
 {
-  return left.Value() > tAngle<TLeftElement, TLeftUnitPolicy, TAutoWrapPolicy>(right).Value();
+  return left.Value() > static_cast<TLeftElement>(TLeftUnitPolicy::ConvertFromUnit(static_cast<decltype(TLeftElement() + TRightElement())>(right.Value()), TRightUnitPolicy()));
 }
 
 /*! Not greater-than
@@ -101,6 +101,18 @@ struct AutoWrapPolicy<angle::NoWrap, TOther>
   typedef angle::NoWrap tType;
 };
 
+template <typename TUnitPolicy>
+struct DefaultTrigonometryPolicy
+{
+  typedef angle::Exact tType;
+};
+
+template <>
+struct DefaultTrigonometryPolicy<angle::Binary>
+{
+  typedef angle::Table<> tType;
+};
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -0,0 +1,128 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/batch_decompositions.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains batched factor-and-solve functions for many small systems
+ *
+ * \b Batched decompositions
+ *
+ * Solving many independent small linear systems one after another with
+ * tCholeskyDecomposition or tLUDecomposition leaves the vector units of
+ * the processor mostly unused. The functions in this file work on a
+ * structure-of-arrays layout instead: element (row, column) of all
+ * systems is stored contiguously, i.e. element (row, column) of system
+ * s is found at index (row * Trank + column) * count + s. Each step of
+ * the factorization is then a loop over all systems that the compiler
+ * vectorizes, so that as many systems are processed per instruction as
+ * fit into a SIMD register.
+ *
+ * Right-hand sides are stored the same way, i.e. element row of system
+ * s is found at index row * count + s.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__batch_decompositions_h__
+#define __rrlib__math__batch_decompositions_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Factorize and solve many symmetric positive definite systems at once
+ *
+ * Computes the Cholesky decomposition A = C * C' of every system in
+ * \a matrices and solves A * x = b for the corresponding right-hand
+ * side in \a right_sides.
+ *
+ * Systems that are not positive definite do not stop the batch. Their
+ * solutions are set to NaN and they are counted in the return value.
+ *
+ * \param matrices            The Trank x Trank matrices in SoA layout. Their lower triangles are replaced by the factors C.
+ * \param right_sides         The right-hand sides in SoA layout that are replaced by the solutions
+ * \param count               The number of systems in the batch
+ * \param number_of_threads   The number of threads the batch is distributed to
+ *
+ * \return The number of systems that could not be solved
+ */
+template <size_t Trank, typename TElement>
+size_t BatchCholeskySolve(TElement *matrices, TElement *right_sides, size_t count, unsigned int number_of_threads = 1);
+
+/*! Factorize and solve many general systems at once
+ *
+ * Computes the LU decomposition of every system in \a matrices using
+ * partial pivoting and solves A * x = b for the corresponding
+ * right-hand side in \a right_sides. Pivoting is decided per system
+ * without branches, so that all systems still share the same
+ * instruction stream.
+ *
+ * Singular systems do not stop the batch. Their solutions are set to
+ * NaN and they are counted in the return value.
+ *
+ * \param matrices            The Trank x Trank matrices in SoA layout. They are replaced by the row-permuted compact LU factors.
+ * \param right_sides         The right-hand sides in SoA layout that are replaced by the solutions
+ * \param count               The number of systems in the batch
+ * \param number_of_threads   The number of threads the batch is distributed to
+ *
+ * \return The number of systems that could not be solved
+ */
+template <size_t Trank, typename TElement>
+size_t BatchLUSolve(TElement *matrices, TElement *right_sides, size_t count, unsigned int number_of_threads = 1);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/batch_decompositions.hpp"
+
+#endif
@@ -0,0 +1,382 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/batch_decompositions.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+/*! The number of systems processed together, small enough to keep the per-system scratch data on the stack */
+const size_t cBATCH_BLOCK_SIZE = 64;
+
+template <typename TElement>
+void MarkFailedSystems(TElement *right_sides, size_t rank, size_t count, size_t begin, size_t size, const TElement *failed)
+{
+  for (size_t row = 0; row < rank; ++row)
+  {
+    TElement *solution = right_sides + row * count + begin;
+    for (size_t s = 0; s < size; ++s)
+    {
+      solution[s] = failed[s] != 0 ? std::numeric_limits<TElement>::quiet_NaN() : solution[s];
+    }
+  }
+}
+
+template <size_t Trank, typename TElement>
+size_t BatchCholeskySolveBlock(TElement *matrices, TElement *right_sides, size_t count, size_t begin, size_t size)
+{
+  auto element = [matrices, count, begin](size_t row, size_t column)
+  {
+    return matrices + (row * Trank + column) * count + begin;
+  };
+  auto right_side = [right_sides, count, begin](size_t row)
+  {
+    return right_sides + row * count + begin;
+  };
+
+  TElement failed[cBATCH_BLOCK_SIZE] = { 0 };
+
+  for (size_t step = 0; step < Trank; ++step)
+  {
+    TElement *diagonal = element(step, step);
+    for (size_t k = 0; k < step; ++k)
+    {
+      const TElement *factor = element(step, k);
+      for (size_t s = 0; s < size; ++s)
+      {
+        diagonal[s] -= factor[s] * factor[s];
+      }
+    }
+    for (size_t s = 0; s < size; ++s)
+    {
+      failed[s] = diagonal[s] > 0 ? failed[s] : 1;
+      diagonal[s] = diagonal[s] > 0 ? std::sqrt(diagonal[s]) : 1;
+    }
+
+    for (size_t row = step + 1; row < Trank; ++row)
+    {
+      TElement *target = element(row, step);
+      for (size_t k = 0; k < step; ++k)
+      {
+        const TElement *left = element(row, k);
+        const TElement *right = element(step, k);
+        for (size_t s = 0; s < size; ++s)
+        {
+          target[s] -= left[s] * right[s];
+        }
+      }
+      for (size_t s = 0; s < size; ++s)
+      {
+        target[s] /= diagonal[s];
+      }
+    }
+  }
+
+  for (size_t row = 0; row < Trank; ++row)
+  {
+    TElement *target = right_side(row);
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement *factor = element(row, k);
+      const TElement *solved = right_side(k);
+      for (size_t s = 0; s < size; ++s)
+      {
+        target[s] -= factor[s] * solved[s];
+      }
+    }
+    const TElement *diagonal = element(row, row);
+    for (size_t s = 0; s < size; ++s)
+    {
+      target[s] /= diagonal[s];
+    }
+  }
+  for (size_t step = 0; step < Trank; ++step)
+  {
+    size_t row = Trank - step - 1;
+    TElement *target = right_side(row);
+    for (size_t k = row + 1; k < Trank; ++k)
+    {
+      const TElement *factor = element(k, row);
+      const TElement *solved = right_side(k);
+      for (size_t s = 0; s < size; ++s)
+      {
+        target[s] -= factor[s] * solved[s];
+      }
+    }
+    const TElement *diagonal = element(row, row);
+    for (size_t s = 0; s < size; ++s)
+    {
+      target[s] /= diagonal[s];
+    }
+  }
+
+  MarkFailedSystems(right_sides, Trank, count, begin, size, failed);
+
+  size_t failures = 0;
+  for (size_t s = 0; s < size; ++s)
+  {
+    failures += failed[s] != 0;
+  }
+  return failures;
+}
+
+template <size_t Trank, typename TElement>
+size_t BatchLUSolveBlock(TElement *matrices, TElement *right_sides, size_t count, size_t begin, size_t size)
+{
+  auto element = [matrices, count, begin](size_t row, size_t column)
+  {
+    return matrices + (row * Trank + column) * count + begin;
+  };
+  auto right_side = [right_sides, count, begin](size_t row)
+  {
+    return right_sides + row * count + begin;
+  };
+
+  TElement failed[cBATCH_BLOCK_SIZE] = { 0 };
+  TElement pivot_row[cBATCH_BLOCK_SIZE];
+  TElement pivot_magnitude[cBATCH_BLOCK_SIZE];
+
+  for (size_t step = 0; step < Trank; ++step)
+  {
+    // select the pivot of every system without branching on it
+    const TElement *first = element(step, step);
+    for (size_t s = 0; s < size; ++s)
+    {
+      pivot_row[s] = step;
+      pivot_magnitude[s] = std::fabs(first[s]);
+    }
+    for (size_t row = step + 1; row < Trank; ++row)
+    {
+      const TElement *candidate = element(row, step);
+      for (size_t s = 0; s < size; ++s)
+      {
+        const TElement magnitude = std::fabs(candidate[s]);
+        const bool larger = magnitude > pivot_magnitude[s];
+        pivot_row[s] = larger ? row : pivot_row[s];
+        pivot_magnitude[s] = larger ? magnitude : pivot_magnitude[s];
+      }
+    }
+
+    // swap rows by masked blending, as every system might need another row
+    TElement *step_right_side = right_side(step);
+    for (size_t row = step + 1; row < Trank; ++row)
+    {
+      const TElement row_index = row;
+      for (size_t column = 0; column < Trank; ++column)
+      {
+        TElement *upper = element(step, column);
+        TElement *lower = element(row, column);
+        for (size_t s = 0; s < size; ++s)
+        {
+          const bool swap = pivot_row[s] == row_index;
+          const TElement temp = upper[s];
+          upper[s] = swap ? lower[s] : temp;
+          lower[s] = swap ? temp : lower[s];
+        }
+      }
+      TElement *lower = right_side(row);
+      for (size_t s = 0; s < size; ++s)
+      {
+        const bool swap = pivot_row[s] == row_index;
+        const TElement temp = step_right_side[s];
+        step_right_side[s] = swap ? lower[s] : temp;
+        lower[s] = swap ? temp : lower[s];
+      }
+    }
+
+    TElement *diagonal = element(step, step);
+    for (size_t s = 0; s < size; ++s)
+    {
+      failed[s] = pivot_magnitude[s] > 0 ? failed[s] : 1;
+      diagonal[s] = pivot_magnitude[s] > 0 ? diagonal[s] : 1;
+    }
+
+    for (size_t row = step + 1; row < Trank; ++row)
+    {
+      TElement *factor = element(row, step);
+      for (size_t s = 0; s < size; ++s)
+      {
+        factor[s] /= diagonal[s];
+      }
+      for (size_t column = step + 1; column < Trank; ++column)
+      {
+        TElement *target = element(row, column);
+        const TElement *source = element(step, column);
+        for (size_t s = 0; s < size; ++s)
+        {
+          target[s] -= factor[s] * source[s];
+        }
+      }
+      TElement *target = right_side(row);
+      for (size_t s = 0; s < size; ++s)
+      {
+        target[s] -= factor[s] * step_right_side[s];
+      }
+    }
+  }
+
+  for (size_t step = 0; step < Trank; ++step)
+  {
+    size_t row = Trank - step - 1;
+    TElement *target = right_side(row);
+    for (size_t k = row + 1; k < Trank; ++k)
+    {
+      const TElement *factor = element(row, k);
+      const TElement *solved = right_side(k);
+      for (size_t s = 0; s < size; ++s)
+      {
+        target[s] -= factor[s] * solved[s];
+      }
+    }
+    const TElement *diagonal = element(row, row);
+    for (size_t s = 0; s < size; ++s)
+    {
+      target[s] /= diagonal[s];
+    }
+  }
+
+  MarkFailedSystems(right_sides, Trank, count, begin, size, failed);
+
+  size_t failures = 0;
+  for (size_t s = 0; s < size; ++s)
+  {
+    failures += failed[s] != 0;
+  }
+  return failures;
+}
+
+template <typename TBlockSolver>
+size_t ProcessBatch(size_t count, unsigned int number_of_threads, TBlockSolver block_solver)
+{
+  const size_t number_of_blocks = (count + cBATCH_BLOCK_SIZE - 1) / cBATCH_BLOCK_SIZE;
+  auto process_blocks = [count, number_of_blocks, &block_solver](size_t first_block, size_t stride)
+  {
+    size_t failures = 0;
+    for (size_t block = first_block; block < number_of_blocks; block += stride)
+    {
+      const size_t begin = block * cBATCH_BLOCK_SIZE;
+      failures += block_solver(begin, std::min(cBATCH_BLOCK_SIZE, count - begin));
+    }
+    return failures;
+  };
+
+  if (number_of_threads <= 1 || number_of_blocks <= 1)
+  {
+    return process_blocks(0, 1);
+  }
+
+  const size_t stride = std::min<size_t>(number_of_threads, number_of_blocks);
+  std::vector<size_t> failures(stride, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(stride - 1);
+  for (size_t i = 1; i < stride; ++i)
+  {
+    threads.emplace_back([&process_blocks, &failures, i, stride]
+    {
+      failures[i] = process_blocks(i, stride);
+    });
+  }
+  failures[0] = process_blocks(0, stride);
+
+  size_t result = failures[0];
+  for (size_t i = 1; i < stride; ++i)
+  {
+    threads[i - 1].join();
+    result += failures[i];
+  }
+  return result;
+}
+
+}
+
+//----------------------------------------------------------------------
+// BatchCholeskySolve
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+size_t BatchCholeskySolve(TElement *matrices, TElement *right_sides, size_t count, unsigned int number_of_threads)
+{
+  return ProcessBatch(count, number_of_threads, [matrices, right_sides, count](size_t begin, size_t size)
+  {
+    return BatchCholeskySolveBlock<Trank>(matrices, right_sides, count, begin, size);
+  });
+}
+
+//----------------------------------------------------------------------
+// BatchLUSolve
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+size_t BatchLUSolve(TElement *matrices, TElement *right_sides, size_t count, unsigned int number_of_threads)
+{
+  return ProcessBatch(count, number_of_threads, [matrices, right_sides, count](size_t begin, size_t size)
+  {
+    return BatchLUSolveBlock<Trank>(matrices, right_sides, count, begin, size);
+  });
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,268 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/conjugate_gradient.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains a preconditioned conjugate gradient solver
+ *
+ * \b Conjugate gradient
+ *
+ * Iteratively solves A * x = b for symmetric positive definite A using
+ * only products of A with vectors. It is therefore applicable to systems
+ * that are too large to be factorized, and a good initial guess, e.g.
+ * the solution of the previous time step, together with a loose
+ * tolerance gives cheap approximate solutions.
+ *
+ * A is given as an operator, i.e. any type providing
+ *
+ *   size_t GetNumberOfRows() const
+ *   size_t GetNumberOfColumns() const
+ *   void Multiply(const TElement *x, TElement *y) const
+ *
+ * to compute y = A * x. tSparseMatrix and tBlockSparseMatrix fulfill this
+ * directly, dense matrices are wrapped by tDenseOperator.
+ *
+ * Preconditioners are types providing
+ *
+ *   size_t GetDimension() const
+ *   void Apply(const TElement *residual, TElement *result) const
+ *
+ * to compute an approximation of A^-1 * residual.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__conjugate_gradient_h__
+#define __rrlib__math__conjugate_gradient_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tSparseMatrix.h"
+#include "rrlib/math/tBlockSparseMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! The outcome of a conjugate gradient solve
+template <typename TElement>
+struct tConjugateGradientResult
+{
+  size_t iterations;
+  TElement residual_norm;
+  bool converged;
+};
+
+//! Operator adapter for dense matrices
+/*!
+ * Holds a copy of the fixed-size matrix, so it may be constructed from
+ * temporaries.
+ */
+template <size_t Tdimension, typename TElement = double>
+class tDenseOperator
+{
+public:
+
+  explicit tDenseOperator(const tMatrix<Tdimension, Tdimension, TElement> &matrix)
+    : matrix(matrix)
+  {}
+
+  inline size_t GetNumberOfRows() const
+  {
+    return Tdimension;
+  }
+
+  inline size_t GetNumberOfColumns() const
+  {
+    return Tdimension;
+  }
+
+  void Multiply(const TElement *x, TElement *y) const;
+
+private:
+
+  tMatrix<Tdimension, Tdimension, TElement> matrix;
+
+};
+
+//! The trivial preconditioner that leaves residuals unchanged
+template <typename TElement = double>
+class tIdentityPreconditioner
+{
+public:
+
+  explicit tIdentityPreconditioner(size_t dimension)
+    : dimension(dimension)
+  {}
+
+  inline size_t GetDimension() const
+  {
+    return this->dimension;
+  }
+
+  void Apply(const TElement *residual, TElement *result) const;
+
+private:
+
+  size_t dimension;
+
+};
+
+//! Preconditioner that scales by the inverse diagonal of A
+template <typename TElement = double>
+class tJacobiPreconditioner
+{
+public:
+
+  /*! Ctor from the diagonal of A
+   *
+   * \exception std::logic_error if the diagonal contains non-positive elements
+   */
+  explicit tJacobiPreconditioner(const std::vector<TElement> &diagonal);
+
+  explicit tJacobiPreconditioner(const tSparseMatrix<TElement> &matrix);
+
+  template <size_t Tdimension>
+  explicit tJacobiPreconditioner(const tMatrix<Tdimension, Tdimension, TElement> &matrix);
+
+  inline size_t GetDimension() const
+  {
+    return this->inverse_diagonal.size();
+  }
+
+  void Apply(const TElement *residual, TElement *result) const;
+
+private:
+
+  std::vector<TElement> inverse_diagonal;
+
+  void Invert();
+
+};
+
+//! Preconditioner that multiplies by the inverses of the diagonal blocks of A
+/*!
+ * Much more effective than tJacobiPreconditioner for problems whose
+ * unknowns are strongly coupled within groups, e.g. the coordinates of
+ * one pose.
+ */
+template <size_t Tblock_size, typename TElement = double>
+class tBlockJacobiPreconditioner
+{
+public:
+
+  /*! Ctor from the diagonal blocks of A
+   *
+   * \exception std::logic_error if a block is not positive definite
+   */
+  explicit tBlockJacobiPreconditioner(const std::vector<tMatrix<Tblock_size, Tblock_size, TElement>> &diagonal_blocks);
+
+  /*! Ctor from the diagonal blocks of a scalar sparse matrix
+   *
+   * \exception std::logic_error if the dimension of \a matrix is no multiple of Tblock_size or a block is not positive definite
+   */
+  explicit tBlockJacobiPreconditioner(const tSparseMatrix<TElement> &matrix);
+
+  explicit tBlockJacobiPreconditioner(const tBlockSparseMatrix<Tblock_size, Tblock_size, TElement> &matrix);
+
+  inline size_t GetDimension() const
+  {
+    return this->inverse_blocks.size() * Tblock_size;
+  }
+
+  void Apply(const TElement *residual, TElement *result) const;
+
+private:
+
+  std::vector<tMatrix<Tblock_size, Tblock_size, TElement>> inverse_blocks;
+
+  void Invert();
+
+};
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Solve A * x = b with the preconditioned conjugate gradient method
+ *
+ * The iteration stops as soon as the norm of the residual b - A * x is
+ * at most \a tolerance times the norm of b, or after \a max_iterations.
+ *
+ * \param matrix           The symmetric positive definite operator A
+ * \param right_side       The right-hand side b
+ * \param solution         The initial guess for x, which is replaced by the result. Must have the same size as \a right_side.
+ * \param preconditioner   The preconditioner for A
+ * \param tolerance        The relative residual norm to reach
+ * \param max_iterations   The maximum number of iterations
+ *
+ * \return The number of iterations, the final residual norm and whether the tolerance was reached
+ *
+ * \exception std::logic_error if the dimensions of \a matrix, \a solution or \a preconditioner do not match \a right_side
+ */
+template <typename TElement, typename TOperator, typename TPreconditioner>
+typename std::enable_if < !std::is_arithmetic<TPreconditioner>::value, tConjugateGradientResult<TElement> >::type ConjugateGradientSolve(const TOperator &matrix, const std::vector<TElement> &right_side, std::vector<TElement> &solution,
+    const TPreconditioner &preconditioner, double tolerance = 1E-6, size_t max_iterations = 1000);
+
+/*! Solve A * x = b with the unpreconditioned conjugate gradient method
+ *
+ * \see ConjugateGradientSolve
+ */
+template <typename TElement, typename TOperator>
+tConjugateGradientResult<TElement> ConjugateGradientSolve(const TOperator &matrix, const std::vector<TElement> &right_side, std::vector<TElement> &solution,
+    double tolerance = 1E-6, size_t max_iterations = 1000);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/conjugate_gradient.hpp"
+
+#endif
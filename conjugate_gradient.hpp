@@ -0,0 +1,352 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/conjugate_gradient.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tCholeskyDecomposition.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+template <typename TElement>
+TElement ConjugateGradientDotProduct(const std::vector<TElement> &left, const std::vector<TElement> &right)
+{
+  TElement sum = 0;
+  for (size_t i = 0; i < left.size(); ++i)
+  {
+    sum += left[i] * right[i];
+  }
+  return sum;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tDenseOperator Multiply
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+void tDenseOperator<Tdimension, TElement>::Multiply(const TElement *x, TElement *y) const
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&this->matrix);
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    TElement sum = 0;
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      sum += data[row * Tdimension + column] * x[column];
+    }
+    y[row] = sum;
+  }
+}
+
+//----------------------------------------------------------------------
+// tIdentityPreconditioner Apply
+//----------------------------------------------------------------------
+template <typename TElement>
+void tIdentityPreconditioner<TElement>::Apply(const TElement *residual, TElement *result) const
+{
+  std::copy(residual, residual + this->dimension, result);
+}
+
+//----------------------------------------------------------------------
+// tJacobiPreconditioner constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+tJacobiPreconditioner<TElement>::tJacobiPreconditioner(const std::vector<TElement> &diagonal)
+  : inverse_diagonal(diagonal)
+{
+  this->Invert();
+}
+
+template <typename TElement>
+tJacobiPreconditioner<TElement>::tJacobiPreconditioner(const tSparseMatrix<TElement> &matrix)
+  : inverse_diagonal(matrix.GetNumberOfRows(), 0)
+{
+  for (size_t i = 0; i < this->inverse_diagonal.size(); ++i)
+  {
+    this->inverse_diagonal[i] = matrix(i, i);
+  }
+  this->Invert();
+}
+
+template <typename TElement>
+template <size_t Tdimension>
+tJacobiPreconditioner<TElement>::tJacobiPreconditioner(const tMatrix<Tdimension, Tdimension, TElement> &matrix)
+  : inverse_diagonal(Tdimension, 0)
+{
+  for (size_t i = 0; i < Tdimension; ++i)
+  {
+    this->inverse_diagonal[i] = matrix[i][i];
+  }
+  this->Invert();
+}
+
+//----------------------------------------------------------------------
+// tJacobiPreconditioner Invert
+//----------------------------------------------------------------------
+template <typename TElement>
+void tJacobiPreconditioner<TElement>::Invert()
+{
+  for (auto it = this->inverse_diagonal.begin(); it != this->inverse_diagonal.end(); ++it)
+  {
+    if (*it <= 0)
+    {
+      throw std::logic_error("Matrix not positive definite!");
+    }
+    *it = 1 / *it;
+  }
+}
+
+//----------------------------------------------------------------------
+// tJacobiPreconditioner Apply
+//----------------------------------------------------------------------
+template <typename TElement>
+void tJacobiPreconditioner<TElement>::Apply(const TElement *residual, TElement *result) const
+{
+  for (size_t i = 0; i < this->inverse_diagonal.size(); ++i)
+  {
+    result[i] = this->inverse_diagonal[i] * residual[i];
+  }
+}
+
+//----------------------------------------------------------------------
+// tBlockJacobiPreconditioner constructors
+//----------------------------------------------------------------------
+template <size_t Tblock_size, typename TElement>
+tBlockJacobiPreconditioner<Tblock_size, TElement>::tBlockJacobiPreconditioner(const std::vector<tMatrix<Tblock_size, Tblock_size, TElement>> &diagonal_blocks)
+  : inverse_blocks(diagonal_blocks)
+{
+  this->Invert();
+}
+
+template <size_t Tblock_size, typename TElement>
+tBlockJacobiPreconditioner<Tblock_size, TElement>::tBlockJacobiPreconditioner(const tSparseMatrix<TElement> &matrix)
+{
+  if (matrix.GetNumberOfRows() % Tblock_size != 0)
+  {
+    throw std::logic_error("Matrix dimension is no multiple of block size!");
+  }
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  const std::vector<TElement> &values = matrix.GetValues();
+  this->inverse_blocks.resize(matrix.GetNumberOfRows() / Tblock_size);
+  for (size_t row = 0; row < matrix.GetNumberOfRows(); ++row)
+  {
+    const size_t block = row / Tblock_size;
+    const size_t first_column = block * Tblock_size;
+    auto begin = column_indices.begin() + row_offsets[row];
+    auto end = column_indices.begin() + row_offsets[row + 1];
+    for (auto it = std::lower_bound(begin, end, first_column); it != end && *it < first_column + Tblock_size; ++it)
+    {
+      this->inverse_blocks[block][row - first_column][*it - first_column] = values[it - column_indices.begin()];
+    }
+  }
+  this->Invert();
+}
+
+template <size_t Tblock_size, typename TElement>
+tBlockJacobiPreconditioner<Tblock_size, TElement>::tBlockJacobiPreconditioner(const tBlockSparseMatrix<Tblock_size, Tblock_size, TElement> &matrix)
+  : inverse_blocks(matrix.GetNumberOfBlockRows())
+{
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  for (size_t block_row = 0; block_row < matrix.GetNumberOfBlockRows(); ++block_row)
+  {
+    auto begin = column_indices.begin() + row_offsets[block_row];
+    auto end = column_indices.begin() + row_offsets[block_row + 1];
+    auto it = std::lower_bound(begin, end, block_row);
+    if (it != end && *it == block_row)
+    {
+      this->inverse_blocks[block_row] = matrix.GetBlocks()[it - column_indices.begin()];
+    }
+  }
+  this->Invert();
+}
+
+//----------------------------------------------------------------------
+// tBlockJacobiPreconditioner Invert
+//----------------------------------------------------------------------
+template <size_t Tblock_size, typename TElement>
+void tBlockJacobiPreconditioner<Tblock_size, TElement>::Invert()
+{
+  for (auto it = this->inverse_blocks.begin(); it != this->inverse_blocks.end(); ++it)
+  {
+    *it = tCholeskyDecomposition<Tblock_size, TElement>(*it).Inverse();
+  }
+}
+
+//----------------------------------------------------------------------
+// tBlockJacobiPreconditioner Apply
+//----------------------------------------------------------------------
+template <size_t Tblock_size, typename TElement>
+void tBlockJacobiPreconditioner<Tblock_size, TElement>::Apply(const TElement *residual, TElement *result) const
+{
+  for (size_t block = 0; block < this->inverse_blocks.size(); ++block)
+  {
+    const TElement *data = reinterpret_cast<const TElement *>(&this->inverse_blocks[block]);
+    const TElement *block_residual = residual + block * Tblock_size;
+    TElement *block_result = result + block * Tblock_size;
+    for (size_t row = 0; row < Tblock_size; ++row)
+    {
+      TElement sum = 0;
+      for (size_t column = 0; column < Tblock_size; ++column)
+      {
+        sum += data[row * Tblock_size + column] * block_residual[column];
+      }
+      block_result[row] = sum;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// ConjugateGradientSolve
+//----------------------------------------------------------------------
+template <typename TElement, typename TOperator, typename TPreconditioner>
+typename std::enable_if < !std::is_arithmetic<TPreconditioner>::value, tConjugateGradientResult<TElement> >::type ConjugateGradientSolve(const TOperator &matrix, const std::vector<TElement> &right_side, std::vector<TElement> &solution,
+    const TPreconditioner &preconditioner, double tolerance, size_t max_iterations)
+{
+  const size_t dimension = right_side.size();
+  if (solution.size() != dimension)
+  {
+    throw std::logic_error("Dimensions of initial guess and right-hand side do not match!");
+  }
+  if (matrix.GetNumberOfRows() != dimension || matrix.GetNumberOfColumns() != dimension)
+  {
+    throw std::logic_error("Dimensions of operator and right-hand side do not match!");
+  }
+  if (preconditioner.GetDimension() != dimension)
+  {
+    throw std::logic_error("Dimensions of preconditioner and right-hand side do not match!");
+  }
+
+  std::vector<TElement> residual(dimension);
+  std::vector<TElement> preconditioned(dimension);
+  std::vector<TElement> direction(dimension);
+  std::vector<TElement> product(dimension);
+
+  // the initial guess serves as warm start
+  matrix.Multiply(solution.data(), product.data());
+  for (size_t i = 0; i < dimension; ++i)
+  {
+    residual[i] = right_side[i] - product[i];
+  }
+
+  const TElement threshold = tolerance * std::sqrt(ConjugateGradientDotProduct(right_side, right_side));
+  tConjugateGradientResult<TElement> result = { 0, std::sqrt(ConjugateGradientDotProduct(residual, residual)), false };
+  if (result.residual_norm <= threshold)
+  {
+    result.converged = true;
+    return result;
+  }
+
+  preconditioner.Apply(residual.data(), preconditioned.data());
+  direction = preconditioned;
+  TElement rho = ConjugateGradientDotProduct(residual, preconditioned);
+
+  while (result.iterations < max_iterations)
+  {
+    matrix.Multiply(direction.data(), product.data());
+    const TElement curvature = ConjugateGradientDotProduct(direction, product);
+    if (curvature <= 0)
+    {
+      break;
+    }
+    const TElement alpha = rho / curvature;
+    for (size_t i = 0; i < dimension; ++i)
+    {
+      solution[i] += alpha * direction[i];
+      residual[i] -= alpha * product[i];
+    }
+    result.iterations++;
+
+    result.residual_norm = std::sqrt(ConjugateGradientDotProduct(residual, residual));
+    if (result.residual_norm <= threshold)
+    {
+      result.converged = true;
+      break;
+    }
+
+    preconditioner.Apply(residual.data(), preconditioned.data());
+    const TElement next_rho = ConjugateGradientDotProduct(residual, preconditioned);
+    const TElement beta = next_rho / rho;
+    rho = next_rho;
+    for (size_t i = 0; i < dimension; ++i)
+    {
+      direction[i] = preconditioned[i] + beta * direction[i];
+    }
+  }
+
+  return result;
+}
+
+template <typename TElement, typename TOperator>
+tConjugateGradientResult<TElement> ConjugateGradientSolve(const TOperator &matrix, const std::vector<TElement> &right_side, std::vector<TElement> &solution,
+    double tolerance, size_t max_iterations)
+{
+  return ConjugateGradientSolve(matrix, right_side, solution, tIdentityPreconditioner<TElement>(right_side.size()), tolerance, max_iterations);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
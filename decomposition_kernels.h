@@ -0,0 +1,207 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/decomposition_kernels.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains the fixed-size kernels used by the matrix decompositions
+ *
+ * \b Decomposition kernels
+ *
+ * The factorization and substitution steps of tCholeskyDecomposition,
+ * tLUDecomposition and tLowerTriangularMatrix work on raw row-major
+ * arrays whose dimensions are known at compile time. For dimensions up
+ * to cMAX_UNROLLED_DIMENSION the loops of these kernels are unrolled
+ * via template recursion, so that e.g. a 6x6 factorization becomes
+ * straight-line code that keeps its operands in registers. Larger
+ * dimensions fall back to ordinary loops to keep the code size sane.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__decomposition_kernels_h__
+#define __rrlib__math__decomposition_kernels_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace kernels
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Loops over up to this many iterations are unrolled at compile time */
+const size_t cMAX_UNROLLED_DIMENSION = 12;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A loop over the range [Tbegin, Tend) that is unrolled for short ranges
+/*!
+ * Calls body(i) for every i in [Tbegin, Tend). If the range is short
+ * enough the calls are generated by template recursion, so that i is a
+ * constant in every call once the body is inlined.
+ */
+template <size_t Tbegin, size_t Tend, bool Tunroll = (Tend - Tbegin <= cMAX_UNROLLED_DIMENSION)>
+struct tStaticLoop
+{
+  template <typename TBody>
+  __attribute__((always_inline)) static inline void Run(TBody body)
+  {
+    body(Tbegin);
+    tStaticLoop < Tbegin + 1, Tend, true >::Run(body);
+  }
+};
+
+template <size_t Tend>
+struct tStaticLoop<Tend, Tend, true>
+{
+  template <typename TBody>
+  __attribute__((always_inline)) static inline void Run(TBody)
+  {}
+};
+
+template <size_t Tbegin, size_t Tend>
+struct tStaticLoop<Tbegin, Tend, false>
+{
+  template <typename TBody>
+  __attribute__((always_inline)) static inline void Run(TBody body)
+  {
+    for (size_t i = Tbegin; i < Tend; ++i)
+    {
+      body(i);
+    }
+  }
+};
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Cholesky factorization of a symmetric positive definite matrix
+ *
+ * \param matrix   The Tdimension x Tdimension input matrix in row-major order, of which only the lower triangle is read
+ * \param packed   The resulting lower triangular factor in packed row-major storage
+ *
+ * \return Whether \a matrix is positive definite. \a packed is incomplete otherwise.
+ */
+template <size_t Tdimension, typename TElement>
+bool CholeskyFactorize(const TElement *matrix, TElement *packed) __attribute__((flatten));
+
+/*! Forward substitution with a packed lower triangular matrix
+ *
+ * \param packed   The lower triangular matrix L in packed row-major storage
+ * \param data     The Tdimension x Tcolumns right-hand sides B in row-major order, replaced by the solution of L * X = B
+ */
+template <size_t Tdimension, size_t Tcolumns, typename TElement>
+void LowerTriangularSolve(const TElement *packed, TElement *data) __attribute__((flatten));
+
+/*! Backward substitution with the transpose of a packed lower triangular matrix
+ *
+ * \param packed   The lower triangular matrix L in packed row-major storage
+ * \param data     The Tdimension x Tcolumns right-hand sides B in row-major order, replaced by the solution of L' * X = B
+ */
+template <size_t Tdimension, size_t Tcolumns, typename TElement>
+void LowerTriangularTransposedSolve(const TElement *packed, TElement *data) __attribute__((flatten));
+
+/*! LU factorization with scaled partial pivoting
+ *
+ * Factorizes the Trows x Trank matrix \a data in place. Afterwards, its
+ * first Trank rows contain the unit lower triangular factor L below and
+ * the upper triangular factor U on and above the diagonal.
+ *
+ * \param data    The matrix in row-major order that is replaced by its factorization
+ * \param pivot   The Trank row indices that were swapped with the row of the same step
+ *
+ * \return Whether \a data has rank Trank. The factorization is incomplete otherwise.
+ */
+template <size_t Trows, size_t Trank, typename TElement>
+bool LUFactorize(TElement *data, size_t *pivot) __attribute__((flatten));
+
+/*! Solve with a compact LU factorization
+ *
+ * \param lu      The Trank x Trank factorization as computed by LUFactorize
+ * \param pivot   The pivot indices as computed by LUFactorize
+ * \param data    The right-hand sides in row-major order with Tcolumns columns and as many rows as the factorized matrix. Its first Trank rows are replaced by the solution.
+ */
+template <size_t Trank, size_t Tcolumns, typename TElement>
+void LUSolve(const TElement *lu, const size_t *pivot, TElement *data) __attribute__((flatten));
+
+/*! Solve with the transpose of a compact LU factorization
+ *
+ * \param lu      The Trank x Trank factorization as computed by LUFactorize
+ * \param pivot   The pivot indices as computed by LUFactorize, or nullptr to solve (L * U)' * X = B
+ * \param data    The right-hand sides in row-major order with Tcolumns columns and as many rows as the factorized matrix. Its first Trank rows are replaced by the solution.
+ */
+template <size_t Trank, size_t Tcolumns, typename TElement>
+void LUTransposedSolve(const TElement *lu, const size_t *pivot, TElement *data) __attribute__((flatten));
+
+/*! Estimate the 1-norm of the inverse of a factorized matrix
+ *
+ * Uses Hager's method with Higham's refinements: a few solves with the
+ * matrix and its transpose replace the O(n^3) computation of the
+ * inverse. The result is a lower bound of the exact norm that is
+ * usually exact or within a factor of 3.
+ *
+ * \param solve              Callable that replaces its TElement * argument x by A^-1 * x
+ * \param solve_transposed   Callable that replaces its TElement * argument x by A'^-1 * x
+ *
+ * \return The estimate of |A^-1|_1
+ */
+template <size_t Tdimension, typename TElement, typename TSolve, typename TSolveTransposed>
+TElement EstimateInverseOneNorm(TSolve solve, TSolveTransposed solve_transposed);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#include "rrlib/math/decomposition_kernels.hpp"
+
+#endif
@@ -0,0 +1,428 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/decomposition_kernels.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/utilities.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+namespace kernels
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// CholeskyFactorize
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+bool CholeskyFactorize(const TElement *matrix, TElement *packed)
+{
+  bool positive_definite = true;
+  tStaticLoop<0, Tdimension>::Run([&](size_t row)
+  {
+    TElement *current_row = packed + row * (row + 1) / 2;
+    tStaticLoop<0, Tdimension>::Run([&](size_t column)
+    {
+      if (column > row || !positive_definite)
+      {
+        return;
+      }
+      const TElement *column_row = packed + column * (column + 1) / 2;
+      TElement value = matrix[row * Tdimension + column];
+      for (size_t k = 0; k < column; ++k)
+      {
+        value -= current_row[k] * column_row[k];
+      }
+
+      if (column < row)
+      {
+        current_row[column] = value / column_row[column];
+        return;
+      }
+
+      if (value <= 0)
+      {
+        positive_definite = false;
+        return;
+      }
+      current_row[row] = std::sqrt(value);
+    });
+  });
+  return positive_definite;
+}
+
+//----------------------------------------------------------------------
+// LowerTriangularSolve
+//----------------------------------------------------------------------
+template <size_t Tdimension, size_t Tcolumns, typename TElement>
+void LowerTriangularSolve(const TElement *packed, TElement *data)
+{
+  tStaticLoop<0, Tdimension>::Run([&](size_t row)
+  {
+    const TElement *lower_row = packed + row * (row + 1) / 2;
+    TElement *current_row = data + row * Tcolumns;
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement factor = lower_row[k];
+      const TElement *solved_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+    const TElement inverse_diagonal = 1 / lower_row[row];
+    tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+    {
+      current_row[column] *= inverse_diagonal;
+    });
+  });
+}
+
+//----------------------------------------------------------------------
+// LowerTriangularTransposedSolve
+//----------------------------------------------------------------------
+template <size_t Tdimension, size_t Tcolumns, typename TElement>
+void LowerTriangularTransposedSolve(const TElement *packed, TElement *data)
+{
+  // L' is traversed column-wise in the packed rows, so that every solved
+  // row is eliminated from all remaining ones right away
+  tStaticLoop<0, Tdimension>::Run([&](size_t step)
+  {
+    const size_t row = Tdimension - step - 1;
+    const TElement *lower_row = packed + row * (row + 1) / 2;
+    TElement *solved_row = data + row * Tcolumns;
+    const TElement inverse_diagonal = 1 / lower_row[row];
+    tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+    {
+      solved_row[column] *= inverse_diagonal;
+    });
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement factor = lower_row[k];
+      TElement *current_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+  });
+}
+
+//----------------------------------------------------------------------
+// LUFactorize
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Trank, typename TElement>
+bool LUFactorize(TElement *data, size_t *pivot)
+{
+  bool full_rank = true;
+  tStaticLoop<0, Trank>::Run([&](size_t step)
+  {
+    if (!full_rank)
+    {
+      return;
+    }
+
+    TElement relative_maximum = 0;
+    pivot[step] = step;
+    for (size_t row = step; row < Trows; ++row)
+    {
+      const TElement *current_row = data + row * Trank;
+      TElement row_sum = 0;
+      for (size_t column = step; column < Trank; ++column)
+      {
+        row_sum += AbsoluteValue(current_row[column]);
+      }
+      if (row_sum != 0)
+      {
+        TElement normalized_first = AbsoluteValue(current_row[step]) / row_sum;
+        if (normalized_first > relative_maximum)
+        {
+          relative_maximum = normalized_first;
+          pivot[step] = row;
+        }
+      }
+    }
+
+    if (relative_maximum == 0)
+    {
+      full_rank = false;
+      return;
+    }
+
+    TElement *step_row = data + step * Trank;
+    if (pivot[step] != step)
+    {
+      TElement *pivot_row = data + pivot[step] * Trank;
+      tStaticLoop<0, Trank>::Run([&](size_t column)
+      {
+        std::swap(step_row[column], pivot_row[column]);
+      });
+    }
+
+    const TElement inverse_pivot = 1 / step_row[step];
+    for (size_t row = step + 1; row < Trows; ++row)
+    {
+      TElement *current_row = data + row * Trank;
+      const TElement factor = current_row[step] * inverse_pivot;
+      current_row[step] = factor;
+      for (size_t column = step + 1; column < Trank; ++column)
+      {
+        current_row[column] -= factor * step_row[column];
+      }
+    }
+  });
+  return full_rank && data[Trank * Trank - 1] != 0;
+}
+
+//----------------------------------------------------------------------
+// LUSolve
+//----------------------------------------------------------------------
+template <size_t Trank, size_t Tcolumns, typename TElement>
+void LUSolve(const TElement *lu, const size_t *pivot, TElement *data)
+{
+  tStaticLoop<0, Trank>::Run([&](size_t i)
+  {
+    if (pivot && pivot[i] != i)
+    {
+      TElement *current_row = data + i * Tcolumns;
+      TElement *pivot_row = data + pivot[i] * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        std::swap(current_row[column], pivot_row[column]);
+      });
+    }
+  });
+
+  tStaticLoop<0, Trank>::Run([&](size_t row)
+  {
+    const TElement *lower_row = lu + row * Trank;
+    TElement *current_row = data + row * Tcolumns;
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement factor = lower_row[k];
+      const TElement *solved_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+  });
+
+  tStaticLoop<0, Trank>::Run([&](size_t step)
+  {
+    const size_t row = Trank - step - 1;
+    const TElement *upper_row = lu + row * Trank;
+    TElement *current_row = data + row * Tcolumns;
+    for (size_t k = row + 1; k < Trank; ++k)
+    {
+      const TElement factor = upper_row[k];
+      const TElement *solved_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+    const TElement inverse_diagonal = 1 / upper_row[row];
+    tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+    {
+      current_row[column] *= inverse_diagonal;
+    });
+  });
+}
+
+//----------------------------------------------------------------------
+// LUTransposedSolve
+//----------------------------------------------------------------------
+template <size_t Trank, size_t Tcolumns, typename TElement>
+void LUTransposedSolve(const TElement *lu, const size_t *pivot, TElement *data)
+{
+  // U' * Z = B by forward substitution
+  tStaticLoop<0, Trank>::Run([&](size_t row)
+  {
+    TElement *current_row = data + row * Tcolumns;
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement factor = lu[k * Trank + row];
+      const TElement *solved_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+    const TElement inverse_diagonal = 1 / lu[row * Trank + row];
+    tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+    {
+      current_row[column] *= inverse_diagonal;
+    });
+  });
+
+  // L' * Y = Z by backward substitution with unit diagonal
+  tStaticLoop<0, Trank>::Run([&](size_t step)
+  {
+    const size_t row = Trank - step - 1;
+    TElement *current_row = data + row * Tcolumns;
+    for (size_t k = row + 1; k < Trank; ++k)
+    {
+      const TElement factor = lu[k * Trank + row];
+      const TElement *solved_row = data + k * Tcolumns;
+      tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      });
+    }
+  });
+
+  // X = P' * Y by undoing the row swaps in reverse order
+  if (pivot)
+  {
+    tStaticLoop<0, Trank>::Run([&](size_t step)
+    {
+      const size_t i = Trank - step - 1;
+      if (pivot[i] != i)
+      {
+        TElement *current_row = data + i * Tcolumns;
+        TElement *pivot_row = data + pivot[i] * Tcolumns;
+        tStaticLoop<0, Tcolumns>::Run([&](size_t column)
+        {
+          std::swap(current_row[column], pivot_row[column]);
+        });
+      }
+    });
+  }
+}
+
+//----------------------------------------------------------------------
+// EstimateInverseOneNorm
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement, typename TSolve, typename TSolveTransposed>
+TElement EstimateInverseOneNorm(TSolve solve, TSolveTransposed solve_transposed)
+{
+  const size_t cMAX_ITERATIONS = 5;
+
+  TElement x[Tdimension];
+  for (size_t i = 0; i < Tdimension; ++i)
+  {
+    x[i] = TElement(1) / Tdimension;
+  }
+
+  TElement estimate = 0;
+  size_t last_index = Tdimension;
+  for (size_t iteration = 0; iteration < cMAX_ITERATIONS; ++iteration)
+  {
+    solve(x);
+    TElement norm = 0;
+    for (size_t i = 0; i < Tdimension; ++i)
+    {
+      norm += AbsoluteValue(x[i]);
+    }
+    if (iteration > 0 && norm <= estimate)
+    {
+      break;
+    }
+    estimate = norm;
+
+    for (size_t i = 0; i < Tdimension; ++i)
+    {
+      x[i] = x[i] < 0 ? -1 : 1;
+    }
+    solve_transposed(x);
+
+    size_t index = 0;
+    for (size_t i = 1; i < Tdimension; ++i)
+    {
+      if (AbsoluteValue(x[i]) > AbsoluteValue(x[index]))
+      {
+        index = i;
+      }
+    }
+    if (index == last_index)
+    {
+      break;
+    }
+    last_index = index;
+
+    for (size_t i = 0; i < Tdimension; ++i)
+    {
+      x[i] = 0;
+    }
+    x[index] = 1;
+  }
+
+  // Higham's alternating vector catches matrices for which the
+  // iteration above gets stuck in a local maximum
+  for (size_t i = 0; i < Tdimension; ++i)
+  {
+    x[i] = (i % 2 ? -1 : 1) * (1 + (Tdimension > 1 ? TElement(i) / (Tdimension - 1) : 0));
+  }
+  solve(x);
+  TElement alternative = 0;
+  for (size_t i = 0; i < Tdimension; ++i)
+  {
+    alternative += AbsoluteValue(x[i]);
+  }
+  alternative *= TElement(2) / (3 * Tdimension);
+
+  return std::max(estimate, alternative);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,124 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/inverse_updates.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains low-rank updates of explicitly stored inverses
+ *
+ * \b Inverse updates
+ *
+ * If the inverse of a matrix A is kept explicitly and A changes by a
+ * matrix of low rank, the Sherman-Morrison-Woodbury formula
+ *
+ *   (A + U * V)^-1 = A^-1 - A^-1 * U * (I + V * A^-1 * U)^-1 * V * A^-1
+ *
+ * yields the new inverse in O(n^2 k) instead of inverting from scratch.
+ * If the k x k capacitance matrix I + V * A^-1 * U is close to singular
+ * the formula loses accuracy. The update then recomputes the inverse
+ * from the updated matrix via tLUDecomposition instead.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__inverse_updates_h__
+#define __rrlib__math__inverse_updates_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Rank-1 update of a matrix and its inverse
+ *
+ * Replaces \a matrix by A + u * v' and \a inverse by its inverse using
+ * the Sherman-Morrison formula.
+ *
+ * \param matrix            The matrix A that is updated
+ * \param inverse           The inverse of A that is updated
+ * \param u                 The column vector of the modification
+ * \param v                 The row vector of the modification
+ * \param min_denominator   The minimum absolute value of 1 + v' * A^-1 * u to use the incremental update
+ *
+ * \return Whether the inverse was updated incrementally, as opposed to recomputed
+ *
+ * \exception std::logic_error if the updated matrix is singular, leaving \a matrix and \a inverse unchanged
+ */
+template <size_t Tdimension, typename TElement>
+bool UpdateInverse(tMatrix<Tdimension, Tdimension, TElement> &matrix, tMatrix<Tdimension, Tdimension, TElement> &inverse,
+                   const tVector<Tdimension, TElement> &u, const tVector<Tdimension, TElement> &v, double min_denominator = 1E-6);
+
+/*! Rank-k update of a matrix and its inverse
+ *
+ * Replaces \a matrix by A + U * V and \a inverse by its inverse using
+ * the Sherman-Morrison-Woodbury formula.
+ *
+ * \param matrix               The matrix A that is updated
+ * \param inverse              The inverse of A that is updated
+ * \param U                    The Tdimension x Trank left factor of the modification
+ * \param V                    The Trank x Tdimension right factor of the modification
+ * \param min_determinant      The minimum absolute determinant of I + V * A^-1 * U to use the incremental update
+ *
+ * \return Whether the inverse was updated incrementally, as opposed to recomputed
+ *
+ * \exception std::logic_error if the updated matrix is singular, leaving \a matrix and \a inverse unchanged
+ */
+template <size_t Tdimension, size_t Trank, typename TElement>
+bool UpdateInverse(tMatrix<Tdimension, Tdimension, TElement> &matrix, tMatrix<Tdimension, Tdimension, TElement> &inverse,
+                   const tMatrix<Tdimension, Trank, TElement> &U, const tMatrix<Trank, Tdimension, TElement> &V, double min_determinant = 1E-6);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/inverse_updates.hpp"
+
+#endif
@@ -0,0 +1,159 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/inverse_updates.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/utilities.h"
+#include "rrlib/math/tLUDecomposition.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// UpdateInverse
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+bool UpdateInverse(tMatrix<Tdimension, Tdimension, TElement> &matrix, tMatrix<Tdimension, Tdimension, TElement> &inverse,
+                   const tVector<Tdimension, TElement> &u, const tVector<Tdimension, TElement> &v, double min_denominator)
+{
+  // matrix and inverse are only changed once the update can not fail anymore
+  tMatrix<Tdimension, Tdimension, TElement> updated(matrix);
+  TElement *matrix_data = reinterpret_cast<TElement *>(&updated);
+  TElement *inverse_data = reinterpret_cast<TElement *>(&inverse);
+  const TElement *u_data = reinterpret_cast<const TElement *>(&u);
+  const TElement *v_data = reinterpret_cast<const TElement *>(&v);
+
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      matrix_data[row * Tdimension + column] += u_data[row] * v_data[column];
+    }
+  }
+
+  // inverse_u = A^-1 * u, v_inverse = v' * A^-1
+  TElement inverse_u[Tdimension];
+  TElement v_inverse[Tdimension] = { 0 };
+  TElement denominator = 1;
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    const TElement *inverse_row = inverse_data + row * Tdimension;
+    inverse_u[row] = 0;
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      inverse_u[row] += inverse_row[column] * u_data[column];
+      v_inverse[column] += v_data[row] * inverse_row[column];
+    }
+    denominator += v_data[row] * inverse_u[row];
+  }
+
+  if (AbsoluteValue(denominator) < min_denominator)
+  {
+    inverse = tLUDecomposition<Tdimension, TElement>(updated).Inverse();
+    matrix = updated;
+    return false;
+  }
+
+  const TElement factor = 1 / denominator;
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    const TElement scaled = inverse_u[row] * factor;
+    TElement *inverse_row = inverse_data + row * Tdimension;
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      inverse_row[column] -= scaled * v_inverse[column];
+    }
+  }
+  matrix = updated;
+  return true;
+}
+
+template <size_t Tdimension, size_t Trank, typename TElement>
+bool UpdateInverse(tMatrix<Tdimension, Tdimension, TElement> &matrix, tMatrix<Tdimension, Tdimension, TElement> &inverse,
+                   const tMatrix<Tdimension, Trank, TElement> &U, const tMatrix<Trank, Tdimension, TElement> &V, double min_determinant)
+{
+  // matrix and inverse are only changed once the update can not fail anymore
+  const tMatrix<Tdimension, Tdimension, TElement> updated(matrix + U * V);
+
+  const tMatrix<Tdimension, Trank, TElement> inverse_U(inverse * U);
+  const tMatrix<Trank, Tdimension, TElement> V_inverse(V * inverse);
+  const tMatrix<Trank, Trank, TElement> capacitance(tMatrix<Trank, Trank, TElement>::Identity() + V * inverse_U);
+
+  try
+  {
+    tLUDecomposition<Trank, TElement> capacitance_decomposition(capacitance);
+    if (AbsoluteValue(capacitance_decomposition.Determinant()) >= min_determinant)
+    {
+      inverse -= inverse_U * capacitance_decomposition.Solve(V_inverse);
+      matrix = updated;
+      return true;
+    }
+  }
+  catch (const std::logic_error &)
+  {}
+
+  inverse = tLUDecomposition<Tdimension, TElement>(updated).Inverse();
+  matrix = updated;
+  return false;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -42,12 +42,14 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/math/tSinCos.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -60,6 +62,9 @@ namespace rrlib
 {
 namespace math
 {
+template <typename TElement>
+class tQuaternion;
+
 namespace matrix
 {
 
@@ -112,88 +117,166 @@ public:
 
   /*! Assumes that the matrix is an orthogonal rotation matrix with det = 1 and calculates the corresponding
    *  rotation axis and angle that the matrix represents.
-   * code taken from Coin 2.4.5 SbRotation.cpp
+   *  The conversion is done by tQuaternion.
    */
   template <typename TVectorElement, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
   void GetRotation(tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle) const
   {
-    const tMatrix *that = reinterpret_cast<const tMatrix *>(this);
-
-    // first, convert matrix to quaternion
-    double s;
-    double quaternion[4];
+    tQuaternion<TElement>(*reinterpret_cast<const tMatrix *>(this)).GetRotation(axis, angle);
+  }
 
-    float scale = (*that)[0][0] + (*that)[1][1] + (*that)[2][2];
+  template <typename TTrigonometryPolicy = angle::Exact, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void ExtractRollPitchYaw(tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &roll, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &pitch, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &yaw, bool use_second_solution = false, double max_error = 1E-6) const
+  {
+    const tMatrix *that = reinterpret_cast<const tMatrix *>(this);
 
-    if (scale > 0)
+    assert(IsEqual(that->Determinant(), 1.0, max_error));
+    if (!use_second_solution)
     {
-      s = std::sqrt(scale + 1.0);
+      roll = ATan2<TTrigonometryPolicy>((*that)[2][1], (*that)[2][2]);
+    }
+    else
+    {
+      roll = ATan2<TTrigonometryPolicy>(-(*that)[2][1], -(*that)[2][2]);
+    }
+    double sin_roll, cos_roll;
+    roll.template SinCos<TTrigonometryPolicy>(sin_roll, cos_roll);
+    pitch = ATan2<TTrigonometryPolicy>(-(*that)[2][0], sin_roll * (*that)[2][1] + cos_roll * (*that)[2][2]);
+    yaw = ATan2<TTrigonometryPolicy>(sin_roll * (*that)[0][2] - cos_roll * (*that)[0][1], cos_roll * (*that)[1][1] - sin_roll * (*that)[1][2]);
+  }
 
-      quaternion[3] = s / 2;
-      s = 0.5 / s;
+  /*! Re-orthonormalizes this matrix by Gram-Schmidt on its rows
+   *
+   *  The first row keeps its direction, the second row is made orthogonal
+   *  to it and the third row is replaced by their cross product, so that
+   *  the result is a proper rotation matrix. This is the cheapest exact
+   *  method, but it distributes the error unevenly over the axes.
+   * \returns reference to this matrix
+   */
+  tMatrix &OrthonormalizeGramSchmidt()
+  {
+    tMatrix *that = reinterpret_cast<tMatrix *>(this);
 
-      quaternion[0] = ((*that)[2][1] - (*that)[1][2]) * s;
-      quaternion[1] = ((*that)[0][2] - (*that)[2][0]) * s;
-      quaternion[2] = ((*that)[1][0] - (*that)[0][1]) * s;
+    TElement x_length_squared = 0;
+    for (size_t column = 0; column < 3; ++column)
+    {
+      x_length_squared += (*that)[0][column] * (*that)[0][column];
     }
-    else
+    const TElement x_scale = 1 / std::sqrt(x_length_squared);
+    TElement projection = 0;
+    for (size_t column = 0; column < 3; ++column)
     {
-      int i = 0;
-      if ((*that)[1][1] > (*that)[0][0])
-      {
-        i = 1;
-      }
-      if ((*that)[2][2] > (*that)[i][i])
-      {
-        i = 2;
-      }
+      (*that)[0][column] *= x_scale;
+      projection += (*that)[0][column] * (*that)[1][column];
+    }
 
-      int j = (i + 1) % 3;
-      int k = (j + 1) % 3;
+    TElement y_length_squared = 0;
+    for (size_t column = 0; column < 3; ++column)
+    {
+      (*that)[1][column] -= projection * (*that)[0][column];
+      y_length_squared += (*that)[1][column] * (*that)[1][column];
+    }
+    const TElement y_scale = 1 / std::sqrt(y_length_squared);
+    for (size_t column = 0; column < 3; ++column)
+    {
+      (*that)[1][column] *= y_scale;
+    }
 
-      s = std::sqrt(((*that)[i][i] - ((*that)[j][j] + (*that)[k][k])) + 1.0);
+    (*that)[2][0] = (*that)[0][1] * (*that)[1][2] - (*that)[0][2] * (*that)[1][1];
+    (*that)[2][1] = (*that)[0][2] * (*that)[1][0] - (*that)[0][0] * (*that)[1][2];
+    (*that)[2][2] = (*that)[0][0] * (*that)[1][1] - (*that)[0][1] * (*that)[1][0];
+    return *that;
+  }
 
-      quaternion[i] = s / 2;
-      s = 0.5 / s;
+  /*! Re-orthonormalizes this matrix by a first-order correction
+   *
+   *  Splits the non-orthogonality of the first two rows evenly between
+   *  them, replaces the third row by their cross product and normalizes
+   *  all rows by a first-order approximation of the inverse square root.
+   *  This needs neither divisions nor square roots and is meant to be
+   *  applied frequently, e.g. after every integration step, so that the
+   *  drift stays small.
+   * \returns reference to this matrix
+   */
+  tMatrix &OrthonormalizeFirstOrder()
+  {
+    tMatrix *that = reinterpret_cast<tMatrix *>(this);
 
-      quaternion[3] = ((*that)[k][j] - (*that)[j][k]) * s;
-      quaternion[j] = ((*that)[j][i] + (*that)[i][j]) * s;
-      quaternion[k] = ((*that)[k][i] + (*that)[i][k]) * s;
+    TElement half_error = 0;
+    for (size_t column = 0; column < 3; ++column)
+    {
+      half_error += (*that)[0][column] * (*that)[1][column];
     }
+    half_error /= 2;
 
-    // convert quaternion to angle
-    axis.Set(0, 0, 1);
-    angle = tAngleRad();
-    if ((quaternion[3] >= -1.0) && (quaternion[3] <= 1.0))
+    TElement rows[3][3];
+    for (size_t column = 0; column < 3; ++column)
     {
-      angle = tAngleRad(std::acos(quaternion[3]) * 2.0);
-      float scale = (angle / 2).Sine();
+      rows[0][column] = (*that)[0][column] - half_error * (*that)[1][column];
+      rows[1][column] = (*that)[1][column] - half_error * (*that)[0][column];
+    }
+    rows[2][0] = rows[0][1] * rows[1][2] - rows[0][2] * rows[1][1];
+    rows[2][1] = rows[0][2] * rows[1][0] - rows[0][0] * rows[1][2];
+    rows[2][2] = rows[0][0] * rows[1][1] - rows[0][1] * rows[1][0];
 
-      if (scale != 0)
+    for (size_t row = 0; row < 3; ++row)
+    {
+      const TElement scale = (3 - (rows[row][0] * rows[row][0] + rows[row][1] * rows[row][1] + rows[row][2] * rows[row][2])) / 2;
+      for (size_t column = 0; column < 3; ++column)
       {
-        axis.Set(quaternion[0] / scale, quaternion[1] / scale, quaternion[2] / scale);
+        (*that)[row][column] = scale * rows[row][column];
       }
     }
+    return *that;
   }
 
-  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
-  void ExtractRollPitchYaw(tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &roll, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &pitch, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &yaw, bool use_second_solution = false, double max_error = 1E-6) const
+  /*! Replaces this matrix by its closest rotation matrix
+   *
+   *  Computes the orthogonal factor of the polar decomposition, which is
+   *  the closest rotation matrix in the Frobenius norm, by the Newton
+   *  iteration R = (R + R^-T) / 2. For slightly drifted matrices it
+   *  converges to machine precision within two or three iterations.
+   *  Assumes a positive determinant.
+   * \param max_iterations   The maximum number of Newton iterations
+   * \returns reference to this matrix
+   */
+  tMatrix &OrthonormalizePolar(unsigned int max_iterations = 10)
   {
-    const tMatrix *that = reinterpret_cast<const tMatrix *>(this);
-
-    assert(IsEqual(that->Determinant(), 1.0, max_error));
-    if (!use_second_solution)
-    {
-      roll = ATan2((*that)[2][1], (*that)[2][2]);
-    }
-    else
+    tMatrix *that = reinterpret_cast<tMatrix *>(this);
+    const TElement tolerance = 16 * std::numeric_limits<TElement>::epsilon() * std::numeric_limits<TElement>::epsilon();
+    for (unsigned int iteration = 0; iteration < max_iterations; ++iteration)
     {
-      roll = ATan2(-(*that)[2][1], -(*that)[2][2]);
+      // R^-T = cofactor matrix / det
+      TElement cofactors[3][3];
+      for (size_t row = 0; row < 3; ++row)
+      {
+        const size_t row_1 = (row + 1) % 3;
+        const size_t row_2 = (row + 2) % 3;
+        for (size_t column = 0; column < 3; ++column)
+        {
+          const size_t column_1 = (column + 1) % 3;
+          const size_t column_2 = (column + 2) % 3;
+          cofactors[row][column] = (*that)[row_1][column_1] * (*that)[row_2][column_2] - (*that)[row_1][column_2] * (*that)[row_2][column_1];
+        }
+      }
+      const TElement half_inverse_determinant = 1 / (2 * ((*that)[0][0] * cofactors[0][0] + (*that)[0][1] * cofactors[0][1] + (*that)[0][2] * cofactors[0][2]));
+
+      TElement change = 0;
+      for (size_t row = 0; row < 3; ++row)
+      {
+        for (size_t column = 0; column < 3; ++column)
+        {
+          const TElement value = (*that)[row][column] / 2 + cofactors[row][column] * half_inverse_determinant;
+          change += (value - (*that)[row][column]) * (value - (*that)[row][column]);
+          (*that)[row][column] = value;
+        }
+      }
+      if (change <= tolerance)
+      {
+        break;
+      }
     }
-    double sin_roll, cos_roll;
-    roll.SinCos(sin_roll, cos_roll);
-    pitch = ATan2(-(*that)[2][0], sin_roll * (*that)[2][1] + cos_roll * (*that)[2][2]);
-    yaw = ATan2(sin_roll * (*that)[0][2] - cos_roll * (*that)[0][1], cos_roll * (*that)[1][1] - sin_roll * (*that)[1][2]);
+    return *that;
   }
 
 //----------------------------------------------------------------------
@@ -242,7 +325,7 @@ public:
     math::tMatrix<3, 3, TElement>(data).GetRotation(axis, angle);
   }
 
-  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  template <typename TTrigonometryPolicy = angle::Exact, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
   void ExtractRollPitchYaw(tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &roll, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &pitch, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &yaw, bool use_second_solution = false, double max_error = 1E-6) const
   {
     const tMatrix *that = reinterpret_cast<const tMatrix *>(this);
@@ -254,57 +337,38 @@ public:
         data[row * 3 + column] = (*that)[row][column];
       }
     }
-    math::tMatrix<3, 3, TElement>(data).ExtractRollPitchYaw(roll, pitch, yaw, use_second_solution, max_error);
+    math::tMatrix<3, 3, TElement>(data).template ExtractRollPitchYaw<TTrigonometryPolicy>(roll, pitch, yaw, use_second_solution, max_error);
   }
 
   /*! Sets this matrix to represent a homogeneous rotation matrix
    *  with given angle around given axis.
    *  If axis is invalid, this is a no-op.
    * \returns reference to this matrix
-   *
-   *  \note: code taken from Coin 2.5.0 SbRotation.cpp
    */
   template <typename TVectorElement, typename TAngleElement = double, typename TUnitPolicy = angle::Radian, typename TAutoWrapPolicy = angle::Signed>
   tMatrix &SetRotation(const tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> angle)
   {
-    tMatrix *that = reinterpret_cast<tMatrix *>(this);
     if (axis.Length() == 0)
     {
-      std::runtime_error("Invalid rotation axis (with zero length)");
+      return *reinterpret_cast<tMatrix *>(this);
     }
+    return this->SetRotation(tQuaternion<TElement>(axis, angle));
+  }
 
-    tVector<3, TVectorElement, vector::Cartesian> normalized_axis(axis.Normalized());
-
-    auto half_angle = angle / 2;
-    double sin_angle = half_angle.Sine();
-    double cos_angle = half_angle.Cosine();
-
-    double x = sin_angle * normalized_axis.X();
-    double y = sin_angle * normalized_axis.Y();
-    double z = sin_angle * normalized_axis.Z();
-    double w = cos_angle;
-
-    that->Set(w * w + x * x - y * y - z * z,
-              2.0 * x * y - 2.0 * w * z,
-              2.0 * x * z + 2.0 * w * y,
-              0.0,
-
-              2.0 * x * y + 2.0 * w * z,
-              w * w - x * x + y * y - z * z,
-              2.0 * y * z - 2.0 * w * x,
-              0.0,
-
-              2.0 * x * z - 2.0 * w * y,
-              2.0 * y * z + 2.0 * w * x,
-              w * w - x * x - y * y + z * z,
-              0.0,
-
-              0.0,
-              0.0,
-              0.0,
-              w * w + x * x + y * y + z * z
-             );
-    return *that;
+  /*! Sets this matrix to represent a homogeneous rotation matrix
+   *  with given angle (with precomputed sine and cosine) around given axis.
+   *  The half angle is derived without calling sine and cosine again.
+   *  If axis is invalid, this is a no-op.
+   * \returns reference to this matrix
+   */
+  template <typename TVectorElement, typename TSinCosElement>
+  tMatrix &SetRotation(const tVector<3, TVectorElement, vector::Cartesian> &axis, const tSinCos<TSinCosElement> &angle)
+  {
+    if (axis.Length() == 0)
+    {
+      return *reinterpret_cast<tMatrix *>(this);
+    }
+    return this->SetRotation(tQuaternion<TElement>(axis, angle));
   }
 
 //----------------------------------------------------------------------
@@ -323,6 +387,18 @@ private:
   Rotation(const Rotation &);
   Rotation &operator = (const Rotation &);
 
+  template <typename TQuaternionElement>
+  tMatrix &SetRotation(const tQuaternion<TQuaternionElement> &rotation)
+  {
+    tMatrix *that = reinterpret_cast<tMatrix *>(this);
+    const math::tMatrix<3, 3, TQuaternionElement> matrix(rotation.GetRotationMatrix());
+    that->Set(matrix[0][0], matrix[0][1], matrix[0][2], 0,
+              matrix[1][0], matrix[1][1], matrix[1][2], 0,
+              matrix[2][0], matrix[2][1], matrix[2][2], 0,
+              0, 0, 0, 1);
+    return *that;
+  }
+
 };
 
 
@@ -48,6 +48,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/math/utilities.h"
+#include "rrlib/math/tSinCos.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -81,6 +82,82 @@ const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(tAngleRad roll
 template <typename TElement>
 const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement y, TElement z, tAngleRad roll, tAngleRad pitch, tAngleRad yaw);
 
+/*! Versions of the functions above for angles with precomputed sine and cosine */
+template <typename TElement, typename TSinCosElement>
+const tMatrix<2, 2, TElement> Get2DRotationMatrix(const tSinCos<TSinCosElement> &angle);
+
+template <typename TElement, typename TSinCosElement>
+const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw);
+
+template <typename TElement, typename TSinCosElement>
+const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement y, TElement z, const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw);
+
+/*! Convert arrays of roll, pitch and yaw into rotation matrices
+ *
+ * Batch version of Get3DRotationMatrixFromRollPitchYaw. The angles are
+ * given in radians in structure-of-arrays layout. Sine and cosine are
+ * evaluated with the batch SinCos function over blocks of angles before
+ * the matrices are assembled. The trigonometry policy allows to select a
+ * faster approximation, e.g. angle::Polynomial<7>, which vectorizes.
+ *
+ * \param roll       The rotations around the x-axis
+ * \param pitch      The rotations around the y-axis
+ * \param yaw        The rotations around the z-axis
+ * \param matrices   The resulting rotation matrices
+ * \param count      The number of rotations
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename TElement>
+void Get3DRotationMatricesFromRollPitchYaw(const TElement *roll, const TElement *pitch, const TElement *yaw, tMatrix<3, 3, TElement> *matrices, size_t count);
+
+template <typename TTrigonometryPolicy = angle::Exact, typename TElement>
+void Get3DRotationMatricesFromRollPitchYaw(const tAngleRad *roll, const tAngleRad *pitch, const tAngleRad *yaw, tMatrix<3, 3, TElement> *matrices, size_t count);
+
+/*! Convert arrays of poses into homogeneous transformation matrices
+ *
+ * Batch version of Get4DTransformationMatrixZYXT with all inputs in
+ * structure-of-arrays layout and the angles in radians
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename TElement>
+void Get4DTransformationMatricesZYXT(const TElement *x, const TElement *y, const TElement *z, const TElement *roll, const TElement *pitch, const TElement *yaw, tMatrix<4, 4, TElement> *matrices, size_t count);
+
+/*! Extract roll, pitch and yaw from an array of rotation matrices
+ *
+ * Batch version of Rotation<3, 3>::ExtractRollPitchYaw for the first
+ * solution. The matrices are expected to be rotation matrices but this
+ * is not checked. Sine and cosine of roll are obtained from the matrix
+ * elements directly, so only three arcus tangents remain per matrix.
+ * They are computed by the given trigonometry policy.
+ *
+ * \param matrices   The rotation matrices
+ * \param roll       The resulting rotations around the x-axis in radians
+ * \param pitch      The resulting rotations around the y-axis in radians
+ * \param yaw        The resulting rotations around the z-axis in radians
+ * \param count      The number of matrices
+ */
+template <typename TTrigonometryPolicy = angle::Exact, typename TElement>
+void ExtractRollPitchYaw(const tMatrix<3, 3, TElement> *matrices, TElement *roll, TElement *pitch, TElement *yaw, size_t count);
+
+/*! Re-orthonormalize an array of rotation matrices by Gram-Schmidt
+ *
+ * \see Rotation<3, 3, TElement>::OrthonormalizeGramSchmidt
+ */
+template <typename TElement>
+void OrthonormalizeGramSchmidt(tMatrix<3, 3, TElement> *matrices, size_t count);
+
+/*! Re-orthonormalize an array of rotation matrices by a first-order correction
+ *
+ * \see Rotation<3, 3, TElement>::OrthonormalizeFirstOrder
+ */
+template <typename TElement>
+void OrthonormalizeFirstOrder(tMatrix<3, 3, TElement> *matrices, size_t count);
+
+/*! Replace an array of matrices by their closest rotation matrices
+ *
+ * \see Rotation<3, 3, TElement>::OrthonormalizePolar
+ */
+template <typename TElement>
+void OrthonormalizePolar(tMatrix<3, 3, TElement> *matrices, size_t count, unsigned int max_iterations = 10);
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -42,6 +42,7 @@
 // External includes with <>
 //----------------------------------------------------------------------
 #include <cmath>
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
 
@@ -96,6 +97,24 @@ const bool operator != (const tMatrix<Trows, Tcolumns, TElement> &left, const tM
 
 template <typename TElement>
 const tMatrix<2, 2, TElement> Get2DRotationMatrix(tAngleRad angle)
+{
+  return Get2DRotationMatrix<TElement>(tSinCos<double>(angle));
+}
+
+template <typename TElement>
+const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(tAngleRad roll, tAngleRad pitch, tAngleRad yaw)
+{
+  return Get3DRotationMatrixFromRollPitchYaw<TElement>(tSinCos<double>(roll), tSinCos<double>(pitch), tSinCos<double>(yaw));
+}
+
+template <typename TElement>
+const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement y, TElement z, tAngleRad roll, tAngleRad pitch, tAngleRad yaw)
+{
+  return Get4DTransformationMatrixZYXT<TElement>(x, y, z, tSinCos<double>(roll), tSinCos<double>(pitch), tSinCos<double>(yaw));
+}
+
+template <typename TElement, typename TSinCosElement>
+const tMatrix<2, 2, TElement> Get2DRotationMatrix(const tSinCos<TSinCosElement> &angle)
 {
   static_assert(std::is_floating_point<TElement>::value, "Instantiation of this method only valid for float or double!");
   TElement sin_angle, cos_angle;
@@ -103,8 +122,8 @@ const tMatrix<2, 2, TElement> Get2DRotationMatrix(tAngleRad angle)
   return tMatrix<2, 2, TElement>(cos_angle, -sin_angle, sin_angle, cos_angle);
 }
 
-template <typename TElement>
-const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(tAngleRad roll, tAngleRad pitch, tAngleRad yaw)
+template <typename TElement, typename TSinCosElement>
+const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw)
 {
   double sin_roll, cos_roll;
   roll.SinCos(sin_roll, cos_roll);
@@ -117,8 +136,8 @@ const tMatrix<3, 3, TElement> Get3DRotationMatrixFromRollPitchYaw(tAngleRad roll
                                  -sin_pitch, sin_roll * cos_pitch, cos_roll * cos_pitch);
 }
 
-template <typename TElement>
-const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement y, TElement z, tAngleRad roll, tAngleRad pitch, tAngleRad yaw)
+template <typename TElement, typename TSinCosElement>
+const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement y, TElement z, const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw)
 {
   double sin_roll, cos_roll;
   roll.SinCos(sin_roll, cos_roll);
@@ -146,6 +165,147 @@ const tMatrix<4, 4, TElement> Get4DTransformationMatrixZYXT(TElement x, TElement
          );
 }
 
+template <typename TTrigonometryPolicy, typename TElement>
+void Get3DRotationMatricesFromRollPitchYaw(const TElement *roll, const TElement *pitch, const TElement *yaw, tMatrix<3, 3, TElement> *matrices, size_t count)
+{
+  static_assert(std::is_floating_point<TElement>::value, "Instantiation of this method only valid for float or double!");
+  const size_t cBLOCK_SIZE = 64;
+  TElement sin_roll[cBLOCK_SIZE], cos_roll[cBLOCK_SIZE];
+  TElement sin_pitch[cBLOCK_SIZE], cos_pitch[cBLOCK_SIZE];
+  TElement sin_yaw[cBLOCK_SIZE], cos_yaw[cBLOCK_SIZE];
+  for (size_t start = 0; start < count; start += cBLOCK_SIZE)
+  {
+    const size_t size = std::min(cBLOCK_SIZE, count - start);
+    math::SinCos<TTrigonometryPolicy>(roll + start, sin_roll, cos_roll, size);
+    math::SinCos<TTrigonometryPolicy>(pitch + start, sin_pitch, cos_pitch, size);
+    math::SinCos<TTrigonometryPolicy>(yaw + start, sin_yaw, cos_yaw, size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      TElement *m = reinterpret_cast<TElement *>(matrices + start + i);
+      m[0] = cos_pitch[i] * cos_yaw[i];
+      m[1] = -cos_roll[i] * sin_yaw[i] + sin_roll[i] * sin_pitch[i] * cos_yaw[i];
+      m[2] = sin_roll[i] * sin_yaw[i] + cos_roll[i] * sin_pitch[i] * cos_yaw[i];
+      m[3] = cos_pitch[i] * sin_yaw[i];
+      m[4] = cos_roll[i] * cos_yaw[i] + sin_roll[i] * sin_pitch[i] * sin_yaw[i];
+      m[5] = -sin_roll[i] * cos_yaw[i] + cos_roll[i] * sin_pitch[i] * sin_yaw[i];
+      m[6] = -sin_pitch[i];
+      m[7] = sin_roll[i] * cos_pitch[i];
+      m[8] = cos_roll[i] * cos_pitch[i];
+    }
+  }
+}
+
+template <typename TTrigonometryPolicy, typename TElement>
+void Get3DRotationMatricesFromRollPitchYaw(const tAngleRad *roll, const tAngleRad *pitch, const tAngleRad *yaw, tMatrix<3, 3, TElement> *matrices, size_t count)
+{
+  const size_t cBLOCK_SIZE = 64;
+  TElement roll_values[cBLOCK_SIZE], pitch_values[cBLOCK_SIZE], yaw_values[cBLOCK_SIZE];
+  for (size_t start = 0; start < count; start += cBLOCK_SIZE)
+  {
+    const size_t size = std::min(cBLOCK_SIZE, count - start);
+    for (size_t i = 0; i < size; ++i)
+    {
+      roll_values[i] = roll[start + i].Value();
+      pitch_values[i] = pitch[start + i].Value();
+      yaw_values[i] = yaw[start + i].Value();
+    }
+    Get3DRotationMatricesFromRollPitchYaw<TTrigonometryPolicy>(roll_values, pitch_values, yaw_values, matrices + start, size);
+  }
+}
+
+template <typename TTrigonometryPolicy, typename TElement>
+void Get4DTransformationMatricesZYXT(const TElement *x, const TElement *y, const TElement *z, const TElement *roll, const TElement *pitch, const TElement *yaw, tMatrix<4, 4, TElement> *matrices, size_t count)
+{
+  const size_t cBLOCK_SIZE = 64;
+  tMatrix<3, 3, TElement> rotations[cBLOCK_SIZE];
+  for (size_t start = 0; start < count; start += cBLOCK_SIZE)
+  {
+    const size_t size = std::min(cBLOCK_SIZE, count - start);
+    Get3DRotationMatricesFromRollPitchYaw<TTrigonometryPolicy>(roll + start, pitch + start, yaw + start, rotations, size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      const TElement *r = reinterpret_cast<const TElement *>(rotations + i);
+      TElement *m = reinterpret_cast<TElement *>(matrices + start + i);
+      const TElement translation[3] = { x[start + i], y[start + i], z[start + i] };
+
+      // same layout as Get4DTransformationMatrixZYXT
+      for (size_t row = 0; row < 3; ++row)
+      {
+        for (size_t column = 0; column < 3; ++column)
+        {
+          m[row * 4 + column] = r[column * 3 + row];
+        }
+        m[row * 4 + 3] = 0;
+      }
+      for (size_t column = 0; column < 3; ++column)
+      {
+        m[12 + column] = r[column * 3] * translation[0] + r[column * 3 + 1] * translation[1] + r[column * 3 + 2] * translation[2];
+      }
+      m[15] = 1;
+    }
+  }
+}
+
+template <typename TTrigonometryPolicy, typename TElement>
+void ExtractRollPitchYaw(const tMatrix<3, 3, TElement> *matrices, TElement *roll, TElement *pitch, TElement *yaw, size_t count)
+{
+  static_assert(std::is_floating_point<TElement>::value, "Instantiation of this method only valid for float or double!");
+  const size_t cBLOCK_SIZE = 64;
+  TElement m01[cBLOCK_SIZE], m02[cBLOCK_SIZE], m11[cBLOCK_SIZE], m12[cBLOCK_SIZE], m20[cBLOCK_SIZE], m21[cBLOCK_SIZE], m22[cBLOCK_SIZE];
+  for (size_t start = 0; start < count; start += cBLOCK_SIZE)
+  {
+    // gather the needed elements in structure-of-arrays layout, so that the loop computing the angles vectorizes
+    const size_t size = std::min(cBLOCK_SIZE, count - start);
+    for (size_t i = 0; i < size; ++i)
+    {
+      const TElement *m = reinterpret_cast<const TElement *>(matrices + start + i);
+      m01[i] = m[1];
+      m02[i] = m[2];
+      m11[i] = m[4];
+      m12[i] = m[5];
+      m20[i] = m[6];
+      m21[i] = m[7];
+      m22[i] = m[8];
+    }
+    for (size_t i = 0; i < size; ++i)
+    {
+      const TElement length = std::sqrt(m21[i] * m21[i] + m22[i] * m22[i]);
+      const TElement sin_roll = length > 0 ? m21[i] / length : 0;
+      const TElement cos_roll = length > 0 ? m22[i] / length : 1;
+      roll[start + i] = TTrigonometryPolicy::ATan2(m21[i], m22[i]);
+      pitch[start + i] = TTrigonometryPolicy::ATan2(-m20[i], sin_roll * m21[i] + cos_roll * m22[i]);
+      yaw[start + i] = TTrigonometryPolicy::ATan2(sin_roll * m02[i] - cos_roll * m01[i], cos_roll * m11[i] - sin_roll * m12[i]);
+    }
+  }
+}
+
+template <typename TElement>
+void OrthonormalizeGramSchmidt(tMatrix<3, 3, TElement> *matrices, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    matrices[i].OrthonormalizeGramSchmidt();
+  }
+}
+
+template <typename TElement>
+void OrthonormalizeFirstOrder(tMatrix<3, 3, TElement> *matrices, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    matrices[i].OrthonormalizeFirstOrder();
+  }
+}
+
+template <typename TElement>
+void OrthonormalizePolar(tMatrix<3, 3, TElement> *matrices, size_t count, unsigned int max_iterations)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    matrices[i].OrthonormalizePolar(max_iterations);
+  }
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -0,0 +1,132 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/matrix_exponential.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains the matrix exponential and the discretization of linear systems
+ *
+ * \b Matrix exponential
+ *
+ * exp(A) is computed by scaling and squaring: A is scaled by 2^-s so
+ * that its infinity norm does not exceed 1/2, the exponential of the
+ * scaled matrix is approximated by a diagonal Pade approximant of
+ * degree 6, which is accurate to double precision in that range, and
+ * the result is squared s times.
+ *
+ * The continuous-time system dx/dt = A * x + w with white noise of
+ * spectral density Q is discretized for a time step dt by Van Loan's
+ * method, which yields the transition matrix exp(A * dt) and the
+ * discrete process noise covariance from a single exponential of a
+ * block matrix of twice the dimension.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__matrix_exponential_h__
+#define __rrlib__math__matrix_exponential_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! The matrix exponential of a fixed-size matrix
+ *
+ * \param matrix   The square matrix A
+ *
+ * \return exp(A)
+ */
+template <size_t Tdimension, typename TElement>
+const tMatrix<Tdimension, Tdimension, TElement> MatrixExponential(const tMatrix<Tdimension, Tdimension, TElement> &matrix);
+
+/*! The matrix exponential of a runtime-sized matrix
+ *
+ * \param matrix      The dimension x dimension matrix A in row-major order
+ * \param dimension   The number of rows and columns of \a matrix
+ * \param result      The dimension x dimension output exp(A) in row-major order
+ */
+template <typename TElement>
+void MatrixExponential(const TElement *matrix, size_t dimension, TElement *result);
+
+/*! Discretize a fixed-size continuous-time linear system
+ *
+ * \param system_matrix           The system matrix A of dx/dt = A * x + w
+ * \param noise_matrix            The spectral density Q of the white noise w, e.g. G * Qc * G'
+ * \param time_step               The time step dt
+ * \param transition_matrix       The discrete transition matrix exp(A * dt)
+ * \param discrete_noise_matrix   The discrete process noise covariance, the integral of exp(A * t) * Q * exp(A * t)' over [0, dt]
+ */
+template <size_t Tdimension, typename TElement>
+void DiscretizeLinearSystem(const tMatrix<Tdimension, Tdimension, TElement> &system_matrix, const tMatrix<Tdimension, Tdimension, TElement> &noise_matrix, TElement time_step,
+                            tMatrix<Tdimension, Tdimension, TElement> &transition_matrix, tMatrix<Tdimension, Tdimension, TElement> &discrete_noise_matrix);
+
+/*! Discretize a runtime-sized continuous-time linear system
+ *
+ * All matrices are dimension x dimension and stored in row-major order.
+ *
+ * \param system_matrix           The system matrix A of dx/dt = A * x + w
+ * \param noise_matrix            The spectral density Q of the white noise w, e.g. G * Qc * G'
+ * \param dimension               The dimension of the state x
+ * \param time_step               The time step dt
+ * \param transition_matrix       The discrete transition matrix exp(A * dt)
+ * \param discrete_noise_matrix   The discrete process noise covariance, the integral of exp(A * t) * Q * exp(A * t)' over [0, dt]
+ */
+template <typename TElement>
+void DiscretizeLinearSystem(const TElement *system_matrix, const TElement *noise_matrix, size_t dimension, TElement time_step,
+                            TElement *transition_matrix, TElement *discrete_noise_matrix);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/matrix_exponential.hpp"
+
+#endif
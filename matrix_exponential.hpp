@@ -0,0 +1,320 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/matrix_exponential.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/utilities.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+const unsigned int cPADE_DEGREE = 6;
+
+/*! Multiply two dimension x dimension matrices in row-major order */
+template <typename TElement>
+void MultiplySquareMatrices(const TElement *left, const TElement *right, size_t dimension, TElement *result)
+{
+  std::memset(result, 0, dimension * dimension * sizeof(TElement));
+  for (size_t row = 0; row < dimension; ++row)
+  {
+    TElement *result_row = result + row * dimension;
+    for (size_t k = 0; k < dimension; ++k)
+    {
+      const TElement factor = left[row * dimension + k];
+      const TElement *right_row = right + k * dimension;
+      for (size_t column = 0; column < dimension; ++column)
+      {
+        result_row[column] += factor * right_row[column];
+      }
+    }
+  }
+}
+
+/*! exp(A) by scaling and squaring with a Pade approximant
+ *
+ * \param matrix      The matrix A, which is scaled in place
+ * \param dimension   The number of rows and columns of A
+ * \param result      The output exp(A)
+ * \param scratch     Temporary memory for 4 * dimension^2 elements
+ */
+template <typename TElement>
+void MatrixExponentialWithScratch(TElement *matrix, size_t dimension, TElement *result, TElement *scratch)
+{
+  const size_t size = dimension * dimension;
+  TElement *power = scratch;
+  TElement *numerator = scratch + size;
+  TElement *denominator = scratch + 2 * size;
+  TElement *temp = scratch + 3 * size;
+
+  // scale A by 2^-s so that its infinity norm is at most 1/2
+  TElement norm = 0;
+  for (size_t row = 0; row < dimension; ++row)
+  {
+    TElement sum = 0;
+    for (size_t column = 0; column < dimension; ++column)
+    {
+      sum += AbsoluteValue(matrix[row * dimension + column]);
+    }
+    norm = std::max(norm, sum);
+  }
+  int exponent = 0;
+  std::frexp(norm, &exponent);
+  const int squarings = std::max(0, exponent + 1);
+  for (size_t i = 0; i < size; ++i)
+  {
+    matrix[i] = std::ldexp(matrix[i], -squarings);
+  }
+
+  // N = sum c_k * A^k and D = sum (-1)^k * c_k * A^k
+  TElement coefficient = 0.5;
+  std::memcpy(power, matrix, size * sizeof(TElement));
+  for (size_t i = 0; i < size; ++i)
+  {
+    numerator[i] = coefficient * matrix[i];
+    denominator[i] = -coefficient * matrix[i];
+  }
+  for (size_t i = 0; i < dimension; ++i)
+  {
+    numerator[i * dimension + i] += 1;
+    denominator[i * dimension + i] += 1;
+  }
+  for (unsigned int k = 2; k <= cPADE_DEGREE; ++k)
+  {
+    coefficient *= TElement(cPADE_DEGREE - k + 1) / (k * (2 * cPADE_DEGREE - k + 1));
+    MultiplySquareMatrices(matrix, power, dimension, temp);
+    std::swap(power, temp);
+    const TElement sign = k % 2 ? -1 : 1;
+    for (size_t i = 0; i < size; ++i)
+    {
+      numerator[i] += coefficient * power[i];
+      denominator[i] += sign * coefficient * power[i];
+    }
+  }
+
+  // D^-1 * N by Gaussian elimination with partial pivoting
+  for (size_t step = 0; step < dimension; ++step)
+  {
+    size_t pivot = step;
+    for (size_t row = step + 1; row < dimension; ++row)
+    {
+      if (AbsoluteValue(denominator[row * dimension + step]) > AbsoluteValue(denominator[pivot * dimension + step]))
+      {
+        pivot = row;
+      }
+    }
+    if (pivot != step)
+    {
+      std::swap_ranges(denominator + step * dimension, denominator + (step + 1) * dimension, denominator + pivot * dimension);
+      std::swap_ranges(numerator + step * dimension, numerator + (step + 1) * dimension, numerator + pivot * dimension);
+    }
+    const TElement *pivot_row = denominator + step * dimension;
+    const TElement *pivot_numerator_row = numerator + step * dimension;
+    for (size_t row = step + 1; row < dimension; ++row)
+    {
+      TElement *current_row = denominator + row * dimension;
+      TElement *current_numerator_row = numerator + row * dimension;
+      const TElement factor = current_row[step] / pivot_row[step];
+      for (size_t column = step; column < dimension; ++column)
+      {
+        current_row[column] -= factor * pivot_row[column];
+      }
+      for (size_t column = 0; column < dimension; ++column)
+      {
+        current_numerator_row[column] -= factor * pivot_numerator_row[column];
+      }
+    }
+  }
+  for (size_t step = 0; step < dimension; ++step)
+  {
+    const size_t row = dimension - step - 1;
+    const TElement *current_row = denominator + row * dimension;
+    TElement *current_numerator_row = numerator + row * dimension;
+    for (size_t k = row + 1; k < dimension; ++k)
+    {
+      const TElement *solved_row = numerator + k * dimension;
+      for (size_t column = 0; column < dimension; ++column)
+      {
+        current_numerator_row[column] -= current_row[k] * solved_row[column];
+      }
+    }
+    const TElement inverse_diagonal = 1 / current_row[row];
+    for (size_t column = 0; column < dimension; ++column)
+    {
+      current_numerator_row[column] *= inverse_diagonal;
+    }
+  }
+
+  // undo the scaling by repeated squaring
+  for (int i = 0; i < squarings; ++i)
+  {
+    MultiplySquareMatrices(numerator, numerator, dimension, temp);
+    std::swap(numerator, temp);
+  }
+  std::memcpy(result, numerator, size * sizeof(TElement));
+}
+
+/*! Van Loan's discretization using the exponential of a 2 * dimension block matrix
+ *
+ * \param scratch   Temporary memory for 24 * dimension^2 elements
+ */
+template <typename TElement>
+void DiscretizeLinearSystemWithScratch(const TElement *system_matrix, const TElement *noise_matrix, size_t dimension, TElement time_step,
+                                       TElement *transition_matrix, TElement *discrete_noise_matrix, TElement *scratch)
+{
+  const size_t block_dimension = 2 * dimension;
+  TElement *block = scratch;
+  TElement *exponential = scratch + block_dimension * block_dimension;
+
+  // M = | -A  Q  | * dt
+  //     |  0  A' |
+  std::memset(block, 0, block_dimension * block_dimension * sizeof(TElement));
+  for (size_t row = 0; row < dimension; ++row)
+  {
+    for (size_t column = 0; column < dimension; ++column)
+    {
+      block[row * block_dimension + column] = -system_matrix[row * dimension + column] * time_step;
+      block[row * block_dimension + dimension + column] = noise_matrix[row * dimension + column] * time_step;
+      block[(dimension + row) * block_dimension + dimension + column] = system_matrix[column * dimension + row] * time_step;
+    }
+  }
+  MatrixExponentialWithScratch(block, block_dimension, exponential, scratch + 2 * block_dimension * block_dimension);
+
+  // exp(M) = | * F^-1 * Qd |
+  //          | 0 F'        |
+  for (size_t row = 0; row < dimension; ++row)
+  {
+    for (size_t column = 0; column < dimension; ++column)
+    {
+      transition_matrix[row * dimension + column] = exponential[(dimension + column) * block_dimension + dimension + row];
+    }
+  }
+  for (size_t row = 0; row < dimension; ++row)
+  {
+    for (size_t column = 0; column <= row; ++column)
+    {
+      TElement sum = 0;
+      TElement transposed_sum = 0;
+      for (size_t k = 0; k < dimension; ++k)
+      {
+        sum += transition_matrix[row * dimension + k] * exponential[k * block_dimension + dimension + column];
+        transposed_sum += transition_matrix[column * dimension + k] * exponential[k * block_dimension + dimension + row];
+      }
+      discrete_noise_matrix[row * dimension + column] = (sum + transposed_sum) / 2;
+      discrete_noise_matrix[column * dimension + row] = discrete_noise_matrix[row * dimension + column];
+    }
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// MatrixExponential
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+const tMatrix<Tdimension, Tdimension, TElement> MatrixExponential(const tMatrix<Tdimension, Tdimension, TElement> &matrix)
+{
+  TElement data[Tdimension * Tdimension];
+  TElement result[Tdimension * Tdimension];
+  TElement scratch[4 * Tdimension * Tdimension];
+  std::memcpy(data, &matrix, sizeof(data));
+  MatrixExponentialWithScratch(data, Tdimension, result, scratch);
+  return tMatrix<Tdimension, Tdimension, TElement>(result);
+}
+
+template <typename TElement>
+void MatrixExponential(const TElement *matrix, size_t dimension, TElement *result)
+{
+  std::vector<TElement> scratch(5 * dimension * dimension);
+  std::copy(matrix, matrix + dimension * dimension, scratch.begin());
+  MatrixExponentialWithScratch(scratch.data(), dimension, result, scratch.data() + dimension * dimension);
+}
+
+//----------------------------------------------------------------------
+// DiscretizeLinearSystem
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+void DiscretizeLinearSystem(const tMatrix<Tdimension, Tdimension, TElement> &system_matrix, const tMatrix<Tdimension, Tdimension, TElement> &noise_matrix, TElement time_step,
+                            tMatrix<Tdimension, Tdimension, TElement> &transition_matrix, tMatrix<Tdimension, Tdimension, TElement> &discrete_noise_matrix)
+{
+  TElement transition[Tdimension * Tdimension];
+  TElement discrete_noise[Tdimension * Tdimension];
+  TElement scratch[24 * Tdimension * Tdimension];
+  DiscretizeLinearSystemWithScratch(reinterpret_cast<const TElement *>(&system_matrix), reinterpret_cast<const TElement *>(&noise_matrix), Tdimension, time_step,
+                                    transition, discrete_noise, scratch);
+  transition_matrix = tMatrix<Tdimension, Tdimension, TElement>(transition);
+  discrete_noise_matrix = tMatrix<Tdimension, Tdimension, TElement>(discrete_noise);
+}
+
+template <typename TElement>
+void DiscretizeLinearSystem(const TElement *system_matrix, const TElement *noise_matrix, size_t dimension, TElement time_step,
+                            TElement *transition_matrix, TElement *discrete_noise_matrix)
+{
+  std::vector<TElement> scratch(24 * dimension * dimension);
+  DiscretizeLinearSystemWithScratch(system_matrix, noise_matrix, dimension, time_step, transition_matrix, discrete_noise_matrix, scratch.data());
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,150 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/schur_complement.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains Schur complement functions for marginalization
+ *
+ * \b Schur complement
+ *
+ * Marginalizing variables out of a Gaussian in information form
+ * partitions the symmetric information matrix and vector into
+ *
+ *   | A  C' |      | a |
+ *   | C  D  |      | d |
+ *
+ * where the rows and columns of D belong to the variables that are
+ * marginalized. The information of the remaining variables is then
+ * given by the Schur complement A - C' * D^-1 * C and the reduced
+ * vector a - C' * D^-1 * d.
+ *
+ * The functions in this file compute both from a Cholesky decomposition
+ * D = L * L' as A - W' * W with W = L^-1 * C. Only the lower triangle
+ * of the information matrix is read and the symmetric result is
+ * computed only once per element pair.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__schur_complement_h__
+#define __rrlib__math__schur_complement_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tCholeskyDecomposition.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Marginalize the trailing variables of a runtime-sized problem in place
+ *
+ * Works on the dimension x dimension row-major \a matrix without any
+ * additional memory. Afterwards, its leading keep x keep block contains
+ * the Schur complement and the first \a keep elements of \a vector
+ * contain the reduced information vector. The remaining elements are
+ * used as scratch space.
+ *
+ * \param matrix      The symmetric information matrix, of which only the lower triangle is read
+ * \param vector      The information vector, or nullptr if only the matrix is needed
+ * \param dimension   The number of variables
+ * \param keep        The number of leading variables that are kept
+ *
+ * \exception std::logic_error if the block of the marginalized variables is not positive definite
+ */
+template <typename TElement>
+void SchurComplementInPlace(TElement *matrix, TElement *vector, size_t dimension, size_t keep);
+
+/*! Marginalize the trailing Tmarginalized variables of a fixed-size information matrix
+ *
+ * \param matrix   The symmetric information matrix, of which only the lower triangle is read
+ *
+ * \return The Schur complement of the trailing block
+ *
+ * \exception std::logic_error if the block of the marginalized variables is not positive definite
+ */
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+const tMatrix<Tkeep, Tkeep, TElement> SchurComplement(const tMatrix < Tkeep + Tmarginalized, Tkeep + Tmarginalized, TElement > &matrix);
+
+/*! Marginalize the trailing Tmarginalized variables of a fixed-size information matrix and vector
+ *
+ * \param matrix           The symmetric information matrix, of which only the lower triangle is read
+ * \param vector           The information vector
+ * \param reduced_matrix   The Schur complement of the trailing block
+ * \param reduced_vector   The reduced information vector
+ *
+ * \exception std::logic_error if the block of the marginalized variables is not positive definite
+ */
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+void SchurComplement(const tMatrix < Tkeep + Tmarginalized, Tkeep + Tmarginalized, TElement > &matrix, const tVector < Tkeep + Tmarginalized, TElement > &vector,
+                     tMatrix<Tkeep, Tkeep, TElement> &reduced_matrix, tVector<Tkeep, TElement> &reduced_vector);
+
+/*! Marginalize with an existing decomposition of the marginalized block
+ *
+ * Replaces \a A by A - C' * D^-1 * C and \a a by a - C' * D^-1 * d,
+ * e.g. when the decomposition of D is already available from solving.
+ *
+ * \param A                 The block of the kept variables that is replaced by the Schur complement
+ * \param a                 The part of the information vector of the kept variables that is reduced
+ * \param C                 The off-diagonal block that couples marginalized and kept variables
+ * \param d                 The part of the information vector of the marginalized variables
+ * \param D_decomposition   The Cholesky decomposition of the block of the marginalized variables
+ */
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+void SchurComplement(tMatrix<Tkeep, Tkeep, TElement> &A, tVector<Tkeep, TElement> &a, const tMatrix<Tmarginalized, Tkeep, TElement> &C,
+                     const tVector<Tmarginalized, TElement> &d, const tCholeskyDecomposition<Tmarginalized, TElement> &D_decomposition);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/schur_complement.hpp"
+
+#endif
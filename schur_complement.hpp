@@ -0,0 +1,237 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/schur_complement.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+/*! Subtract W' * W and W' * w from the kept part
+ *
+ * W is stored in the rows keep..dimension - 1 and columns 0..keep - 1
+ * of \a matrix, w in the elements keep..dimension - 1 of \a vector.
+ */
+template <typename TElement>
+void SubtractSchurProduct(TElement *matrix, TElement *vector, size_t stride, size_t keep, size_t marginalized)
+{
+  const TElement *W = matrix + keep * stride;
+  for (size_t row = 0; row < keep; ++row)
+  {
+    TElement *result_row = matrix + row * stride;
+    for (size_t column = 0; column <= row; ++column)
+    {
+      TElement sum = 0;
+      for (size_t i = 0; i < marginalized; ++i)
+      {
+        sum += W[i * stride + row] * W[i * stride + column];
+      }
+      result_row[column] -= sum;
+      matrix[column * stride + row] = result_row[column];
+    }
+    if (vector)
+    {
+      TElement sum = 0;
+      for (size_t i = 0; i < marginalized; ++i)
+      {
+        sum += W[i * stride + row] * vector[keep + i];
+      }
+      vector[row] -= sum;
+    }
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// SchurComplementInPlace
+//----------------------------------------------------------------------
+template <typename TElement>
+void SchurComplementInPlace(TElement *matrix, TElement *vector, size_t dimension, size_t keep)
+{
+  assert(keep <= dimension);
+  const size_t marginalized = dimension - keep;
+  TElement *D = matrix + keep * dimension + keep;
+  TElement *C = matrix + keep * dimension;
+
+  // D = L * L' in place in the lower triangle of D
+  for (size_t row = 0; row < marginalized; ++row)
+  {
+    TElement *current_row = D + row * dimension;
+    for (size_t column = 0; column <= row; ++column)
+    {
+      const TElement *column_row = D + column * dimension;
+      TElement value = current_row[column];
+      for (size_t k = 0; k < column; ++k)
+      {
+        value -= current_row[k] * column_row[k];
+      }
+      if (column < row)
+      {
+        current_row[column] = value / column_row[column];
+        continue;
+      }
+      if (value <= 0)
+      {
+        throw std::logic_error("Matrix not positive definite!");
+      }
+      current_row[row] = std::sqrt(value);
+    }
+  }
+
+  // W = L^-1 * C and w = L^-1 * d by forward substitution on the rows of C
+  for (size_t row = 0; row < marginalized; ++row)
+  {
+    const TElement *lower_row = D + row * dimension;
+    TElement *current_row = C + row * dimension;
+    for (size_t k = 0; k < row; ++k)
+    {
+      const TElement factor = lower_row[k];
+      const TElement *solved_row = C + k * dimension;
+      for (size_t column = 0; column < keep; ++column)
+      {
+        current_row[column] -= factor * solved_row[column];
+      }
+      if (vector)
+      {
+        vector[keep + row] -= factor * vector[keep + k];
+      }
+    }
+    const TElement inverse_diagonal = 1 / lower_row[row];
+    for (size_t column = 0; column < keep; ++column)
+    {
+      current_row[column] *= inverse_diagonal;
+    }
+    if (vector)
+    {
+      vector[keep + row] *= inverse_diagonal;
+    }
+  }
+
+  SubtractSchurProduct(matrix, vector, dimension, keep, marginalized);
+}
+
+//----------------------------------------------------------------------
+// SchurComplement
+//----------------------------------------------------------------------
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+const tMatrix<Tkeep, Tkeep, TElement> SchurComplement(const tMatrix < Tkeep + Tmarginalized, Tkeep + Tmarginalized, TElement > &matrix)
+{
+  const size_t cDIMENSION = Tkeep + Tmarginalized;
+  TElement data[cDIMENSION * cDIMENSION];
+  std::memcpy(data, &matrix, sizeof(data));
+  SchurComplementInPlace<TElement>(data, nullptr, cDIMENSION, Tkeep);
+
+  TElement result[Tkeep * Tkeep];
+  for (size_t row = 0; row < Tkeep; ++row)
+  {
+    std::memcpy(result + row * Tkeep, data + row * cDIMENSION, Tkeep * sizeof(TElement));
+  }
+  return tMatrix<Tkeep, Tkeep, TElement>(result);
+}
+
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+void SchurComplement(const tMatrix < Tkeep + Tmarginalized, Tkeep + Tmarginalized, TElement > &matrix, const tVector < Tkeep + Tmarginalized, TElement > &vector,
+                     tMatrix<Tkeep, Tkeep, TElement> &reduced_matrix, tVector<Tkeep, TElement> &reduced_vector)
+{
+  const size_t cDIMENSION = Tkeep + Tmarginalized;
+  TElement data[cDIMENSION * cDIMENSION];
+  TElement vector_data[cDIMENSION];
+  std::memcpy(data, &matrix, sizeof(data));
+  std::memcpy(vector_data, &vector, sizeof(vector_data));
+  SchurComplementInPlace<TElement>(data, vector_data, cDIMENSION, Tkeep);
+
+  TElement result[Tkeep * Tkeep];
+  for (size_t row = 0; row < Tkeep; ++row)
+  {
+    std::memcpy(result + row * Tkeep, data + row * cDIMENSION, Tkeep * sizeof(TElement));
+  }
+  reduced_matrix = tMatrix<Tkeep, Tkeep, TElement>(result);
+  reduced_vector = tVector<Tkeep, TElement>(vector_data);
+}
+
+template <size_t Tkeep, size_t Tmarginalized, typename TElement>
+void SchurComplement(tMatrix<Tkeep, Tkeep, TElement> &A, tVector<Tkeep, TElement> &a, const tMatrix<Tmarginalized, Tkeep, TElement> &C,
+                     const tVector<Tmarginalized, TElement> &d, const tCholeskyDecomposition<Tmarginalized, TElement> &D_decomposition)
+{
+  // the rows of W and w are stored behind A and a just like in the
+  // in-place layout with stride Tkeep
+  TElement data[(Tkeep + Tmarginalized) * Tkeep];
+  TElement vector_data[Tkeep + Tmarginalized];
+  std::memcpy(data, &A, Tkeep * Tkeep * sizeof(TElement));
+  std::memcpy(data + Tkeep * Tkeep, &C, Tmarginalized * Tkeep * sizeof(TElement));
+  std::memcpy(vector_data, &a, Tkeep * sizeof(TElement));
+  std::memcpy(vector_data + Tkeep, &d, Tmarginalized * sizeof(TElement));
+
+  D_decomposition.PackedC().template SolveInPlace<Tkeep>(data + Tkeep * Tkeep);
+  D_decomposition.PackedC().template SolveInPlace<1>(vector_data + Tkeep);
+
+  SubtractSchurProduct(data, vector_data, Tkeep, Tkeep, Tmarginalized);
+  A = tMatrix<Tkeep, Tkeep, TElement>(data);
+  a = tVector<Tkeep, TElement>(vector_data);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -46,11 +46,16 @@
 
 #include "rrlib/math/angle/policies/unit/Radian.h"
 #include "rrlib/math/angle/policies/unit/Degree.h"
+#include "rrlib/math/angle/policies/unit/Binary.h"
 
 #include "rrlib/math/angle/policies/wrap/Signed.h"
 #include "rrlib/math/angle/policies/wrap/Unsigned.h"
 #include "rrlib/math/angle/policies/wrap/NoWrap.h"
 
+#include "rrlib/math/angle/policies/trigonometry/Exact.h"
+#include "rrlib/math/angle/policies/trigonometry/Polynomial.h"
+#include "rrlib/math/angle/policies/trigonometry/Table.h"
+
 #include "rrlib/math/angle/tAngle.h"
 
 #include "rrlib/math/angle/functions.h"
@@ -82,6 +87,8 @@ typedef tAngle<double, angle::Degree, angle::Unsigned> tAngleDegUnsigned;
 typedef tAngleRadSigned tAngleRad;
 typedef tAngleDegSigned tAngleDeg;
 
+typedef tAngle<std::uint32_t, angle::Binary, angle::NoWrap> tAngleBinary;
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
@@ -0,0 +1,201 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tBlockSparseMatrix.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tBlockSparseMatrix
+ *
+ * \b tBlockSparseMatrix
+ *
+ * A sparse matrix that consists of dense blocks of fixed size, stored
+ * in compressed sparse row format over the blocks. Pose graphs and
+ * landmark problems naturally produce this structure, as every pose or
+ * landmark contributes a block row and column of its own dimension.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tBlockSparseMatrix_h__
+#define __rrlib__math__tBlockSparseMatrix_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tSparseMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A sparse matrix of dense Tblock_rows x Tblock_columns blocks
+/*!
+ * The block column indices of block row r are stored in ascending
+ * order at positions GetRowOffsets()[r] to GetRowOffsets()[r + 1] - 1
+ * of GetColumnIndices(), the corresponding blocks at the same positions
+ * of GetBlocks().
+ */
+template <size_t Tblock_rows, size_t Tblock_columns, typename TElement = double>
+class tBlockSparseMatrix
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tMatrix<Tblock_rows, Tblock_columns, TElement> tBlock;
+
+  /*! A single block given in coordinate format */
+  struct tEntry
+  {
+    size_t block_row;
+    size_t block_column;
+    tBlock block;
+  };
+
+  /*! Ctor of an empty matrix with the given number of blocks
+   *
+   * \param block_rows      The number of block rows
+   * \param block_columns   The number of block columns
+   */
+  tBlockSparseMatrix(size_t block_rows = 0, size_t block_columns = 0);
+
+  /*! Ctor from blocks in coordinate format
+   *
+   * The entries may be given in any order. Blocks with the same
+   * position are summed up.
+   *
+   * \param block_rows      The number of block rows
+   * \param block_columns   The number of block columns
+   * \param entries         The non-zero blocks
+   *
+   * \exception std::logic_error if an entry lies outside the matrix
+   */
+  tBlockSparseMatrix(size_t block_rows, size_t block_columns, const std::vector<tEntry> &entries);
+
+  inline size_t GetNumberOfBlockRows() const
+  {
+    return this->number_of_block_rows;
+  }
+
+  inline size_t GetNumberOfBlockColumns() const
+  {
+    return this->number_of_block_columns;
+  }
+
+  inline size_t GetNumberOfRows() const
+  {
+    return this->number_of_block_rows * Tblock_rows;
+  }
+
+  inline size_t GetNumberOfColumns() const
+  {
+    return this->number_of_block_columns * Tblock_columns;
+  }
+
+  inline size_t GetNumberOfBlocks() const
+  {
+    return this->blocks.size();
+  }
+
+  inline const std::vector<size_t> &GetRowOffsets() const
+  {
+    return this->row_offsets;
+  }
+
+  inline const std::vector<size_t> &GetColumnIndices() const
+  {
+    return this->column_indices;
+  }
+
+  inline const std::vector<tBlock> &GetBlocks() const
+  {
+    return this->blocks;
+  }
+
+  inline std::vector<tBlock> &GetBlocks()
+  {
+    return this->blocks;
+  }
+
+  /*! Compute y = A * x
+   *
+   * \param x   The GetNumberOfBlockColumns() * Tblock_columns elements of the vector to multiply
+   * \param y   The GetNumberOfBlockRows() * Tblock_rows elements of the result
+   */
+  void Multiply(const TElement *x, TElement *y) const;
+
+  /*! Expand into an elementwise sparse matrix
+   *
+   * All elements of the stored blocks become stored elements of the
+   * result, e.g. to factorize it with tSparseCholeskyDecomposition.
+   *
+   * \return The matrix with the same values in elementwise CSR format
+   */
+  const tSparseMatrix<TElement> GetScalarMatrix() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  size_t number_of_block_rows;
+  size_t number_of_block_columns;
+  std::vector<size_t> row_offsets;
+  std::vector<size_t> column_indices;
+  std::vector<tBlock> blocks;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tBlockSparseMatrix.hpp"
+
+#endif
@@ -0,0 +1,191 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tBlockSparseMatrix.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tBlockSparseMatrix constructors
+//----------------------------------------------------------------------
+template <size_t Tblock_rows, size_t Tblock_columns, typename TElement>
+tBlockSparseMatrix<Tblock_rows, Tblock_columns, TElement>::tBlockSparseMatrix(size_t block_rows, size_t block_columns)
+  : number_of_block_rows(block_rows),
+    number_of_block_columns(block_columns),
+    row_offsets(block_rows + 1, 0)
+{}
+
+template <size_t Tblock_rows, size_t Tblock_columns, typename TElement>
+tBlockSparseMatrix<Tblock_rows, Tblock_columns, TElement>::tBlockSparseMatrix(size_t block_rows, size_t block_columns, const std::vector<tEntry> &entries)
+  : number_of_block_rows(block_rows),
+    number_of_block_columns(block_columns),
+    row_offsets(block_rows + 1, 0)
+{
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->block_row >= block_rows || it->block_column >= block_columns)
+    {
+      throw std::logic_error("Sparse matrix entry out of bounds!");
+    }
+    this->row_offsets[it->block_row + 1]++;
+  }
+  for (size_t row = 0; row < block_rows; ++row)
+  {
+    this->row_offsets[row + 1] += this->row_offsets[row];
+  }
+
+  // bucket the entries by block row, then sort and merge within each row
+  std::vector<const tEntry *> sorted(entries.size());
+  std::vector<size_t> next(this->row_offsets.begin(), this->row_offsets.end() - 1);
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    sorted[next[it->block_row]++] = &*it;
+  }
+
+  this->column_indices.reserve(entries.size());
+  this->blocks.reserve(entries.size());
+  size_t begin = 0;
+  for (size_t row = 0; row < block_rows; ++row)
+  {
+    const size_t end = this->row_offsets[row + 1];
+    std::sort(sorted.begin() + begin, sorted.begin() + end, [](const tEntry * left, const tEntry * right)
+    {
+      return left->block_column < right->block_column;
+    });
+    this->row_offsets[row] = this->column_indices.size();
+    for (size_t i = begin; i < end; ++i)
+    {
+      if (i > begin && sorted[i]->block_column == this->column_indices.back())
+      {
+        this->blocks.back() += sorted[i]->block;
+        continue;
+      }
+      this->column_indices.push_back(sorted[i]->block_column);
+      this->blocks.push_back(sorted[i]->block);
+    }
+    begin = end;
+  }
+  this->row_offsets[block_rows] = this->column_indices.size();
+}
+
+//----------------------------------------------------------------------
+// tBlockSparseMatrix Multiply
+//----------------------------------------------------------------------
+template <size_t Tblock_rows, size_t Tblock_columns, typename TElement>
+void tBlockSparseMatrix<Tblock_rows, Tblock_columns, TElement>::Multiply(const TElement *x, TElement *y) const
+{
+  for (size_t block_row = 0; block_row < this->number_of_block_rows; ++block_row)
+  {
+    TElement *result = y + block_row * Tblock_rows;
+    std::fill(result, result + Tblock_rows, TElement(0));
+    for (size_t i = this->row_offsets[block_row]; i < this->row_offsets[block_row + 1]; ++i)
+    {
+      const TElement *block = reinterpret_cast<const TElement *>(&this->blocks[i]);
+      const TElement *factor = x + this->column_indices[i] * Tblock_columns;
+      for (size_t row = 0; row < Tblock_rows; ++row)
+      {
+        for (size_t column = 0; column < Tblock_columns; ++column)
+        {
+          result[row] += block[row * Tblock_columns + column] * factor[column];
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tBlockSparseMatrix GetScalarMatrix
+//----------------------------------------------------------------------
+template <size_t Tblock_rows, size_t Tblock_columns, typename TElement>
+const tSparseMatrix<TElement> tBlockSparseMatrix<Tblock_rows, Tblock_columns, TElement>::GetScalarMatrix() const
+{
+  const size_t rows = this->number_of_block_rows * Tblock_rows;
+  std::vector<size_t> offsets(rows + 1, 0);
+  std::vector<size_t> indices;
+  std::vector<TElement> values;
+  indices.reserve(this->blocks.size() * Tblock_rows * Tblock_columns);
+  values.reserve(this->blocks.size() * Tblock_rows * Tblock_columns);
+
+  for (size_t block_row = 0; block_row < this->number_of_block_rows; ++block_row)
+  {
+    for (size_t row = 0; row < Tblock_rows; ++row)
+    {
+      for (size_t i = this->row_offsets[block_row]; i < this->row_offsets[block_row + 1]; ++i)
+      {
+        const TElement *block_row_data = reinterpret_cast<const TElement *>(&this->blocks[i]) + row * Tblock_columns;
+        for (size_t column = 0; column < Tblock_columns; ++column)
+        {
+          indices.push_back(this->column_indices[i] * Tblock_columns + column);
+          values.push_back(block_row_data[column]);
+        }
+      }
+      offsets[block_row * Tblock_rows + row + 1] = indices.size();
+    }
+  }
+
+  return tSparseMatrix<TElement>(rows, this->number_of_block_columns * Tblock_columns, offsets, indices, values);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -45,6 +45,7 @@
 //----------------------------------------------------------------------
 #include "rrlib/math/tVector.h"
 #include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tLowerTriangularMatrix.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -80,19 +81,100 @@ public:
 
   tCholeskyDecomposition(const tMatrix<Trank, Trank, TElement> &matrix);
 
-  inline const tMatrix<Trank, Trank, TElement> &C() const
+  /*! The factor C of A = C * C' expanded into a full matrix
+   *
+   * \return The lower triangular factor including the zeros above the diagonal
+   */
+  inline const tMatrix<Trank, Trank, TElement> C() const
+  {
+    return this->cholesky_matrix.GetFullMatrix();
+  }
+
+  /*! The factor C of A = C * C' in packed storage
+   *
+   * \return The lower triangular factor as it is stored by this decomposition
+   */
+  inline const tLowerTriangularMatrix<Trank, TElement> &PackedC() const
   {
     return this->cholesky_matrix;
   }
 
   const tVector<Trank, TElement> Solve(const tVector<Trank, TElement> &right_side) const;
 
+  /*! Solve for multiple right-hand sides at once
+   *
+   * \param right_side   The matrix whose columns are the right-hand sides
+   *
+   * \return The matrix whose columns are the solutions for the corresponding columns of \a right_side
+   */
+  template <size_t Tcolumns>
+  const tMatrix<Trank, Tcolumns, TElement> Solve(const tMatrix<Trank, Tcolumns, TElement> &right_side) const;
+
+  /*! The determinant of the decomposed matrix
+   *
+   * Computed in O(n) as the squared product of the diagonal of C
+   *
+   * \return The determinant
+   */
+  const TElement Determinant() const;
+
+  /*! The natural logarithm of the determinant of the decomposed matrix
+   *
+   * Does not overflow or underflow for large matrices where Determinant()
+   * would, e.g. when evaluating Gaussian likelihoods.
+   *
+   * \return log(det(A))
+   */
+  const TElement LogDeterminant() const;
+
+  /*! The inverse of the decomposed matrix
+   *
+   * Computed in O(n^3) by solving for the identity matrix
+   *
+   * \return The inverse matrix
+   */
+  const tMatrix<Trank, Trank, TElement> Inverse() const;
+
+  /*! An estimate of the condition number of the decomposed matrix in the 1-norm
+   *
+   * The norm of the matrix is stored during decomposition and the norm of
+   * its inverse is estimated in O(n^2) by a few solves with the factor.
+   * After Update() or Downdate() the stored norm is replaced by an upper
+   * bound, so that the estimate errs on the ill-conditioned side.
+   *
+   * \return An estimate of |A|_1 * |A^-1|_1 that is usually exact or within a factor of 3
+   */
+  const TElement EstimatedConditionNumber() const;
+
+  /*! Rank-1 update of the decomposition
+   *
+   * Modifies the stored factor in O(n^2) so that it represents the
+   * decomposition of A + v * v' instead of rebuilding it from scratch.
+   *
+   * \param vector   The vector v of the rank-1 modification
+   */
+  void Update(const tVector<Trank, TElement> &vector);
+
+  /*! Rank-1 downdate of the decomposition
+   *
+   * Modifies the stored factor in O(n^2) so that it represents the
+   * decomposition of A - v * v' instead of rebuilding it from scratch.
+   *
+   * \param vector   The vector v of the rank-1 modification
+   *
+   * \exception std::logic_error if A - v * v' is not positive definite. The decomposition stays unchanged in that case.
+   */
+  void Downdate(const tVector<Trank, TElement> &vector);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
-  tMatrix<Trank, Trank, TElement> cholesky_matrix;
+  tLowerTriangularMatrix<Trank, TElement> cholesky_matrix;
+  TElement norm;
+
+  void AddModificationToNorm(const tVector<Trank, TElement> &vector);
 
 };
 
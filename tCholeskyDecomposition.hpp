@@ -31,10 +31,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cmath>
+#include <cstring>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/math/decomposition_kernels.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -68,61 +72,176 @@ template <size_t Trank, typename TElement>
 tCholeskyDecomposition<Trank, TElement>::tCholeskyDecomposition(const tMatrix<Trank, Trank, TElement> &matrix)
 {
   // FIXME: check if matrix is symmetric
-  for (size_t step = 0; step < Trank; ++step)
+  if (!kernels::CholeskyFactorize<Trank>(reinterpret_cast<const TElement *>(&matrix), this->cholesky_matrix[0]))
   {
-    this->cholesky_matrix[step][step] = matrix[step][step];
-    for (size_t column = 0; column < step; ++column)
-    {
-      this->cholesky_matrix[step][step] -= this->cholesky_matrix[step][column] * this->cholesky_matrix[step][column];
-    }
+    throw std::logic_error("Matrix not positive definite!");
+  }
 
-    if (this->cholesky_matrix[step][step] <= 0)
+  const TElement *data = reinterpret_cast<const TElement *>(&matrix);
+  this->norm = 0;
+  for (size_t column = 0; column < Trank; ++column)
+  {
+    TElement sum = 0;
+    for (size_t row = 0; row < Trank; ++row)
     {
-      throw std::logic_error("Matrix not positive definite!");
+      sum += AbsoluteValue(row < column ? data[column * Trank + row] : data[row * Trank + column]);
     }
+    this->norm = std::max(this->norm, sum);
+  }
+}
+
+//----------------------------------------------------------------------
+// tCholeskyDecomposition Solve
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const tVector<Trank, TElement> tCholeskyDecomposition<Trank, TElement>::Solve(const tVector<Trank, TElement> &right_side) const
+{
+  TElement result[Trank];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->cholesky_matrix.template SolveInPlace<1>(result);
+  this->cholesky_matrix.template SolveTransposedInPlace<1>(result);
+  return tVector<Trank, TElement>(result);
+}
+
+template <size_t Trank, typename TElement>
+template <size_t Tcolumns>
+const tMatrix<Trank, Tcolumns, TElement> tCholeskyDecomposition<Trank, TElement>::Solve(const tMatrix<Trank, Tcolumns, TElement> &right_side) const
+{
+  TElement result[Trank * Tcolumns];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->cholesky_matrix.template SolveInPlace<Tcolumns>(result);
+  this->cholesky_matrix.template SolveTransposedInPlace<Tcolumns>(result);
+  return tMatrix<Trank, Tcolumns, TElement>(result);
+}
 
-    this->cholesky_matrix[step][step] = std::sqrt(this->cholesky_matrix[step][step]);
+//----------------------------------------------------------------------
+// tCholeskyDecomposition Determinant
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tCholeskyDecomposition<Trank, TElement>::Determinant() const
+{
+  TElement product = 1;
+  for (size_t i = 0; i < Trank; ++i)
+  {
+    product *= this->cholesky_matrix[i][i];
+  }
+  return product * product;
+}
 
+//----------------------------------------------------------------------
+// tCholeskyDecomposition LogDeterminant
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tCholeskyDecomposition<Trank, TElement>::LogDeterminant() const
+{
+  TElement sum = 0;
+  for (size_t i = 0; i < Trank; ++i)
+  {
+    sum += std::log(this->cholesky_matrix[i][i]);
+  }
+  return 2 * sum;
+}
+
+//----------------------------------------------------------------------
+// tCholeskyDecomposition Inverse
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const tMatrix<Trank, Trank, TElement> tCholeskyDecomposition<Trank, TElement>::Inverse() const
+{
+  return this->Solve(tMatrix<Trank, Trank, TElement>::Identity());
+}
+
+//----------------------------------------------------------------------
+// tCholeskyDecomposition Update
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+void tCholeskyDecomposition<Trank, TElement>::Update(const tVector<Trank, TElement> &vector)
+{
+  TElement temp[Trank];
+  for (size_t i = 0; i < Trank; ++i)
+  {
+    temp[i] = vector[i];
+  }
+  for (size_t step = 0; step < Trank; ++step)
+  {
+    TElement diagonal = this->cholesky_matrix[step][step];
+    TElement radius = std::sqrt(diagonal * diagonal + temp[step] * temp[step]);
+    TElement cosine = radius / diagonal;
+    TElement sine = temp[step] / diagonal;
+    this->cholesky_matrix[step][step] = radius;
     for (size_t row = step + 1; row < Trank; ++row)
     {
-      this->cholesky_matrix[row][step] = matrix[row][step];
-      for (size_t column = 0; column < step; ++column)
-      {
-        this->cholesky_matrix[row][step] -= this->cholesky_matrix[row][column] * this->cholesky_matrix[step][column];
-      }
-      this->cholesky_matrix[row][step] /= this->cholesky_matrix[step][step];
+      this->cholesky_matrix[row][step] = (this->cholesky_matrix[row][step] + sine * temp[row]) / cosine;
+      temp[row] = cosine * temp[row] - sine * this->cholesky_matrix[row][step];
     }
   }
+  this->AddModificationToNorm(vector);
 }
 
 //----------------------------------------------------------------------
-// tCholeskyDecomposition Solve
+// tCholeskyDecomposition Downdate
 //----------------------------------------------------------------------
 template <size_t Trank, typename TElement>
-const tVector<Trank, TElement> tCholeskyDecomposition<Trank, TElement>::Solve(const tVector<Trank, TElement> &right_side) const
+void tCholeskyDecomposition<Trank, TElement>::Downdate(const tVector<Trank, TElement> &vector)
 {
   TElement temp[Trank];
-  for (size_t row = 0; row < Trank; ++row)
+  for (size_t i = 0; i < Trank; ++i)
   {
-    temp[row] = right_side[row];
-    for (size_t column = 0; column < row; ++column)
-    {
-      temp[row] -= this->cholesky_matrix[row][column] * temp[column];
-    }
-    temp[row] /= this->cholesky_matrix[row][row];
+    temp[i] = vector[i];
   }
-  TElement result[Trank];
+  tLowerTriangularMatrix<Trank, TElement> downdated(this->cholesky_matrix);
   for (size_t step = 0; step < Trank; ++step)
   {
-    size_t row = Trank - step - 1;
-    result[row] = temp[row];
-    for (size_t column = row + 1; column < Trank; ++column)
+    TElement diagonal = downdated[step][step];
+    TElement squared_radius = (diagonal - temp[step]) * (diagonal + temp[step]);
+    if (squared_radius <= 0)
     {
-      result[row] -= this->cholesky_matrix[column][row] * result[column];
+      throw std::logic_error("Downdated matrix not positive definite!");
+    }
+    TElement radius = std::sqrt(squared_radius);
+    TElement cosine = radius / diagonal;
+    TElement sine = temp[step] / diagonal;
+    downdated[step][step] = radius;
+    for (size_t row = step + 1; row < Trank; ++row)
+    {
+      downdated[row][step] = (downdated[row][step] - sine * temp[row]) / cosine;
+      temp[row] = cosine * temp[row] - sine * downdated[row][step];
     }
-    result[row] /= this->cholesky_matrix[row][row];
   }
-  return tVector<Trank, TElement>(result);
+  this->cholesky_matrix = downdated;
+  this->AddModificationToNorm(vector);
+}
+
+//----------------------------------------------------------------------
+// tCholeskyDecomposition EstimatedConditionNumber
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tCholeskyDecomposition<Trank, TElement>::EstimatedConditionNumber() const
+{
+  // the decomposed matrix is symmetric, so both solves are the same
+  auto solve = [this](TElement * x)
+  {
+    this->cholesky_matrix.template SolveInPlace<1>(x);
+    this->cholesky_matrix.template SolveTransposedInPlace<1>(x);
+  };
+  return this->norm * kernels::EstimateInverseOneNorm<Trank, TElement>(solve, solve);
+}
+
+//----------------------------------------------------------------------
+// tCholeskyDecomposition AddModificationToNorm
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+void tCholeskyDecomposition<Trank, TElement>::AddModificationToNorm(const tVector<Trank, TElement> &vector)
+{
+  // |A +- v * v'|_1 <= |A|_1 + |v|_1 * |v|_max
+  TElement sum = 0;
+  TElement maximum = 0;
+  for (size_t i = 0; i < Trank; ++i)
+  {
+    sum += AbsoluteValue(vector[i]);
+    maximum = std::max(maximum, AbsoluteValue(vector[i]));
+  }
+  this->norm += sum * maximum;
 }
 
 //----------------------------------------------------------------------
@@ -0,0 +1,281 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tCircularStatistics.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tCircularStatistics
+ *
+ * \b tCircularStatistics
+ *
+ * A streaming accumulator for the circular mean and variance of angles.
+ * Angles are summed as unit vectors, which is correct across the seam at
+ * +-pi where an arithmetic mean of the values fails. Only the weighted
+ * vector sum is stored, so accumulators from different threads can
+ * simply be merged.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tCircularStatistics_h__
+#define __rrlib__math__tCircularStatistics_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tAngle.h"
+#include "rrlib/math/tSinCos.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Weighted circular statistics of a stream of angles
+/*!
+ * Uses O(1) memory: the sum of weights and the weighted sums of sine and
+ * cosine. The mean resultant length R in [0, 1] describes the
+ * concentration of the angles, the circular variance is 1 - R.
+ */
+template <typename TElement = double>
+class tCircularStatistics
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+  typedef math::tAngle<TElement, angle::Radian, angle::Signed> tAngle;
+
+  inline tCircularStatistics()
+    : total_weight(0), sine_sum(0), cosine_sum(0)
+  {}
+
+  inline void Reset()
+  {
+    this->total_weight = 0;
+    this->sine_sum = 0;
+    this->cosine_sum = 0;
+  }
+
+  /*! Add an angle
+   *
+   * \param angle    The angle to add
+   * \param weight   The non-negative weight of the angle, e.g. of a particle
+   */
+  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  inline void Add(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle, TElement weight = 1)
+  {
+    TElement sine, cosine;
+    angle.SinCos(sine, cosine);
+    this->Accumulate(sine, cosine, weight);
+  }
+
+  /*! Add an angle with already known sine and cosine
+   *
+   * \param angle    The angle to add
+   * \param weight   The non-negative weight of the angle
+   */
+  template <typename TSinCosElement>
+  inline void Add(const tSinCos<TSinCosElement> &angle, TElement weight = 1)
+  {
+    this->Accumulate(angle.Sine(), angle.Cosine(), weight);
+  }
+
+  /*! Add an array of angles
+   *
+   * The sines and cosines are computed blockwise with the batch SinCos
+   * function. The trigonometry policy allows to select a faster
+   * approximation, e.g. Add<angle::Polynomial<7>>(angles, count).
+   *
+   * \param angles   The angles to add
+   * \param count    The number of angles
+   */
+  template <typename TTrigonometryPolicy = angle::Exact, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void Add(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> *angles, size_t count)
+  {
+    this->AddBlockwise<TTrigonometryPolicy>(angles, static_cast<const TElement *>(0), count);
+  }
+
+  /*! Add an array of weighted angles
+   *
+   * \param angles   The angles to add
+   * \param weights  The non-negative weights of the angles
+   * \param count    The number of angles
+   */
+  template <typename TTrigonometryPolicy = angle::Exact, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void Add(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> *angles, const TElement *weights, size_t count)
+  {
+    this->AddBlockwise<TTrigonometryPolicy>(angles, weights, count);
+  }
+
+  /*! Merge the statistics of another accumulator into this one
+   *
+   * The result is the same as if all angles had been added here, so
+   * partial statistics e.g. from several threads can be combined.
+   *
+   * \param other   The other accumulator
+   */
+  inline tCircularStatistics &operator += (const tCircularStatistics &other)
+  {
+    this->total_weight += other.total_weight;
+    this->sine_sum += other.sine_sum;
+    this->cosine_sum += other.cosine_sum;
+    return *this;
+  }
+
+  inline TElement TotalWeight() const
+  {
+    return this->total_weight;
+  }
+
+  /*! The circular mean of the added angles
+   *
+   * \exception std::logic_error if the mean is undefined, i.e. nothing was added or the angles cancel out exactly
+   */
+  inline tAngle Mean() const
+  {
+    if (this->sine_sum == 0 && this->cosine_sum == 0)
+    {
+      throw std::logic_error("The circular mean of an empty or perfectly balanced set of angles is undefined");
+    }
+    return tAngle(std::atan2(this->sine_sum, this->cosine_sum));
+  }
+
+  /*! The length of the mean of the added unit vectors
+   *
+   * \exception std::logic_error if nothing was added
+   *
+   * \return R in [0, 1], where 1 means that all angles are equal
+   */
+  inline TElement MeanResultantLength() const
+  {
+    if (!(this->total_weight > 0))
+    {
+      throw std::logic_error("The circular statistics of an empty set of angles are undefined");
+    }
+    return std::min<TElement>(1, std::sqrt(this->sine_sum * this->sine_sum + this->cosine_sum * this->cosine_sum) / this->total_weight);
+  }
+
+  /*! The circular variance 1 - R in [0, 1]
+   */
+  inline TElement Variance() const
+  {
+    return 1 - this->MeanResultantLength();
+  }
+
+  /*! The circular standard deviation sqrt(-2 ln R) in radians
+   *
+   * For concentrated angles it approximates the ordinary standard
+   * deviation. It is infinite for R = 0.
+   */
+  inline TElement StandardDeviation() const
+  {
+    return std::sqrt(-2 * std::log(this->MeanResultantLength()));
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TElement total_weight;
+  TElement sine_sum;
+  TElement cosine_sum;
+
+  inline void Accumulate(TElement sine, TElement cosine, TElement weight)
+  {
+    this->total_weight += weight;
+    this->sine_sum += weight * sine;
+    this->cosine_sum += weight * cosine;
+  }
+
+  template <typename TTrigonometryPolicy, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void AddBlockwise(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> *angles, const TElement *weights, size_t count)
+  {
+    typedef typename math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy>::tFloatingPoint tFloatingPoint;
+
+    const size_t cBLOCK_SIZE = 64;
+    tFloatingPoint sine[cBLOCK_SIZE], cosine[cBLOCK_SIZE];
+    for (size_t start = 0; start < count; start += cBLOCK_SIZE)
+    {
+      const size_t size = std::min(cBLOCK_SIZE, count - start);
+      math::SinCos<TTrigonometryPolicy>(angles + start, sine, cosine, size);
+
+      TElement weight_sum = 0, sine_sum = 0, cosine_sum = 0;
+      for (size_t i = 0; i < size; ++i)
+      {
+        TElement weight = weights ? weights[start + i] : 1;
+        weight_sum += weight;
+        sine_sum += weight * sine[i];
+        cosine_sum += weight * cosine[i];
+      }
+      this->total_weight += weight_sum;
+      this->sine_sum += sine_sum;
+      this->cosine_sum += cosine_sum;
+    }
+  }
+
+};
+
+//----------------------------------------------------------------------
+// Merging
+//----------------------------------------------------------------------
+
+template <typename TElement>
+inline tCircularStatistics<TElement> operator + (tCircularStatistics<TElement> left, const tCircularStatistics<TElement> &right)
+{
+  return left += right;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
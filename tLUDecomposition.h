@@ -81,27 +81,81 @@ public:
   template <size_t Trows>
   tLUDecomposition(const tMatrix<Trows, Trank, TElement> &matrix);
 
-  inline const tMatrix<Trank, Trank, TElement> &L() const
+  /*! The compact factorization
+   *
+   * Both factors are stored in one matrix: U on and above the diagonal,
+   * L below the diagonal. The unit diagonal of L is not stored.
+   *
+   * \return The compact LU matrix
+   */
+  inline const tMatrix<Trank, Trank, TElement> &LU() const
   {
-    return this->lower;
+    return this->lu;
   }
 
-  inline const tMatrix<Trank, Trank, TElement> &U() const
-  {
-    return this->upper;
-  }
+  const tMatrix<Trank, Trank, TElement> L() const;
+
+  const tMatrix<Trank, Trank, TElement> U() const;
 
   template <size_t Tdimension>
   const tVector<Trank, TElement> Solve(const tVector<Tdimension, TElement> &right_side) const;
 
+  /*! Solve for multiple right-hand sides at once
+   *
+   * Each column of \a right_side is treated as a separate right-hand
+   * side. All columns are processed together in one forward and one
+   * backward substitution pass.
+   *
+   * \param right_side   The matrix of right-hand sides
+   *
+   * \return The matrix whose columns are the solutions for the corresponding columns of \a right_side
+   */
+  template <size_t Trows, size_t Tcolumns>
+  const tMatrix<Trank, Tcolumns, TElement> Solve(const tMatrix<Trows, Tcolumns, TElement> &right_side) const;
+
+  /*! The determinant of the decomposed (square) matrix
+   *
+   * Computed in O(n) from the diagonal of U and the parity of the pivoting
+   *
+   * \return The determinant
+   */
+  const TElement Determinant() const;
+
+  /*! The natural logarithm of the absolute determinant of the decomposed (square) matrix
+   *
+   * Does not overflow or underflow for large matrices where Determinant() would
+   *
+   * \return log(|det(A)|)
+   */
+  const TElement LogDeterminant() const;
+
+  /*! The inverse of the decomposed (square) matrix
+   *
+   * Computed in O(n^3) by solving for the identity matrix
+   *
+   * \return The inverse matrix
+   */
+  const tMatrix<Trank, Trank, TElement> Inverse() const;
+
+  /*! An estimate of the condition number of the decomposed (square) matrix in the 1-norm
+   *
+   * The norm of the matrix is stored during decomposition and the norm of
+   * its inverse is estimated in O(n^2) by a few solves with the factors.
+   * For non-square input the estimate refers to the Trank rows that were
+   * selected as pivots.
+   *
+   * \return An estimate of |A|_1 * |A^-1|_1 that is usually exact or within a factor of 3
+   */
+  const TElement EstimatedConditionNumber() const;
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
-  tMatrix<Trank, Trank, TElement> lower;
-  tMatrix<Trank, Trank, TElement> upper;
+  tMatrix<Trank, Trank, TElement> lu;
   tVector<Trank, size_t> pivot;
+  TElement norm;
 
 };
 
@@ -31,11 +31,15 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cstring>
+#include <algorithm>
+
 #include "rrlib/logging/messages.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/math/decomposition_kernels.h"
 #include "rrlib/math/tCholeskyDecomposition.h"
 
 //----------------------------------------------------------------------
@@ -72,64 +76,36 @@ tLUDecomposition<Trank, TElement>::tLUDecomposition(const tMatrix<Trows, Trank,
 {
   static_assert(Trows >= Trank, "Matrix can not have given rank");
 
-  tMatrix<Trows, Trank, TElement> temp_matrix(matrix);
+  // additional rows of non-square input only need temporary storage
+  // during elimination
+  TElement data[Trows * Trank];
+  std::memcpy(data, &matrix, sizeof(data));
 
-  for (size_t step = 0; step < std::min(Trank, Trows); ++step)
+  if (!kernels::LUFactorize<Trows, Trank>(data, reinterpret_cast<size_t *>(&this->pivot)))
   {
-    RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "step: ", step);
-    TElement relative_maximum = 0;
-    this->pivot[step] = step;
-    for (size_t row = step; row < Trows; ++row)
-    {
-      RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "  row: ", row);
-      TElement row_sum = 0;
-      for (size_t column = step; column < Trank; ++column)
-      {
-        row_sum += AbsoluteValue(temp_matrix[row][column]);
-      }
-      RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "    sum: ", row_sum);
-      if (row_sum != 0)
-      {
-        TElement normalized_first = AbsoluteValue(temp_matrix[row][step]) / row_sum;
-        RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "    normalized_first: ", normalized_first);
-        if (normalized_first > relative_maximum)
-        {
-          relative_maximum = normalized_first;
-          this->pivot[step] = row;
-        }
-      }
-    }
-
-    if (relative_maximum == 0)
-    {
-      throw std::logic_error("Matrix not of expected rank");
-    }
-
-    if (this->pivot[step] != step)
-    {
-      RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "    pivotize: ", step, " <-> ", this->pivot[step]);
-      for (size_t column = 0; column < Trank; ++column)
-      {
-        std::swap(temp_matrix[step][column], temp_matrix[this->pivot[step]][column]);
-      }
-    }
+    throw std::logic_error("Matrix not of expected rank");
+  }
+  this->lu = tMatrix<Trank, Trank, TElement>(data);
 
-    RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "    a[k][k] = a[", step, "][", step, "] = ", temp_matrix[step][step]);
-    for (size_t row = step + 1; row < Trows; ++row)
-    {
-      temp_matrix[row][step] /= temp_matrix[step][step];
-      RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "      a[i][k] = a[", row, "][", step, "] = ", temp_matrix[row][step]);
-      for (size_t column = step + 1; column < Trank; ++column)
-      {
-        temp_matrix[row][column] -= temp_matrix[row][step] * temp_matrix[step][column];
-        RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "      a[i][j] = a[", row, "][", column, "] = ", temp_matrix[row][column]);
-      }
-    }
+  size_t rows[Trows];
+  for (size_t row = 0; row < Trows; ++row)
+  {
+    rows[row] = row;
+  }
+  for (size_t i = 0; i < Trank; ++i)
+  {
+    std::swap(rows[i], rows[this->pivot[i]]);
   }
-  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "matrix: ", temp_matrix);
-  if (temp_matrix[Trank - 1][Trank - 1] == 0)
+  const TElement *input = reinterpret_cast<const TElement *>(&matrix);
+  this->norm = 0;
+  for (size_t column = 0; column < Trank; ++column)
   {
-    throw std::logic_error("Matrix not of expected rank");
+    TElement sum = 0;
+    for (size_t i = 0; i < Trank; ++i)
+    {
+      sum += AbsoluteValue(input[rows[i] * Trank + column]);
+    }
+    this->norm = std::max(this->norm, sum);
   }
 
 // FIXME: we need a different check if there are linear independent rows left
@@ -139,29 +115,54 @@ tLUDecomposition<Trank, TElement>::tLUDecomposition(const tMatrix<Trows, Trank,
 //  {
 //    for (size_t column = 0; column < Trank; ++column)
 //    {
-//      if (temp_matrix[row][column] != 0)
+//      if (data[row * Trank + column] != 0)
 //      {
 //        throw std::logic_error(Matrix not of expected rank");
 //      }
 //    }
 //  }
 
+  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "matrix: ", this->lu);
+  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "pivot: ", this->pivot);
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition L
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const tMatrix<Trank, Trank, TElement> tLUDecomposition<Trank, TElement>::L() const
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&this->lu);
+  TElement result[Trank * Trank];
+  std::memset(result, 0, sizeof(result));
   for (size_t row = 0; row < Trank; ++row)
   {
     for (size_t column = 0; column < row; ++column)
     {
-      this->lower[row][column] = temp_matrix[row][column];
+      result[row * Trank + column] = data[row * Trank + column];
     }
-    this->lower[row][row] = 1;
+    result[row * Trank + row] = 1;
+  }
+  return tMatrix<Trank, Trank, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition U
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const tMatrix<Trank, Trank, TElement> tLUDecomposition<Trank, TElement>::U() const
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&this->lu);
+  TElement result[Trank * Trank];
+  std::memset(result, 0, sizeof(result));
+  for (size_t row = 0; row < Trank; ++row)
+  {
     for (size_t column = row; column < Trank; ++column)
     {
-      this->upper[row][column] = temp_matrix[row][column];
+      result[row * Trank + column] = data[row * Trank + column];
     }
   }
-
-  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "lower: ", this->lower);
-  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "upper: ", this->upper);
-  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "pivot: ", this->pivot);
+  return tMatrix<Trank, Trank, TElement>(result);
 }
 
 //----------------------------------------------------------------------
@@ -176,33 +177,85 @@ const tVector<Trank, TElement> tLUDecomposition<Trank, TElement>::Solve(const tV
   RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "vector: ", right_side);
   RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "pivot: ", this->pivot);
 
-  tVector<Tdimension, TElement> temp(right_side);
-  for (size_t i = 0; i < Trank; ++i)
-  {
-    std::swap(temp[i], temp[this->pivot[i]]);
-  }
+  TElement result[Tdimension];
+  std::memcpy(result, &right_side, sizeof(result));
+  kernels::LUSolve<Trank, 1>(reinterpret_cast<const TElement *>(&this->lu), reinterpret_cast<const size_t *>(&this->pivot), result);
+  return tVector<Trank, TElement>(result);
+}
+
+template <size_t Trank, typename TElement>
+template <size_t Trows, size_t Tcolumns>
+const tMatrix<Trank, Tcolumns, TElement> tLUDecomposition<Trank, TElement>::Solve(const tMatrix<Trows, Tcolumns, TElement> &right_side) const
+{
+  static_assert(Trows >= Trank, "Number of rows of given matrix is too small");
 
-  RRLIB_LOG_PRINT(DEBUG_VERBOSE_3, "pivotized: ", temp);
+  TElement temp[Trows * Tcolumns];
+  std::memcpy(temp, &right_side, sizeof(temp));
+  kernels::LUSolve<Trank, Tcolumns>(reinterpret_cast<const TElement *>(&this->lu), reinterpret_cast<const size_t *>(&this->pivot), temp);
 
-  for (size_t row = 0; row < Trank; ++row)
+  return tMatrix<Trank, Tcolumns, TElement>(temp);
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition Determinant
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tLUDecomposition<Trank, TElement>::Determinant() const
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&this->lu);
+  TElement determinant = 1;
+  for (size_t i = 0; i < Trank; ++i)
   {
-    for (size_t column = 0; column < row; ++column)
+    determinant *= data[i * Trank + i];
+    if (this->pivot[i] != i)
     {
-      temp[row] -= this->lower[row][column] * temp[column];
+      determinant = -determinant;
     }
   }
-  TElement result[Trank];
-  for (size_t step = 0; step < Trank; ++step)
+  return determinant;
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition LogDeterminant
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tLUDecomposition<Trank, TElement>::LogDeterminant() const
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&this->lu);
+  TElement log_determinant = 0;
+  for (size_t i = 0; i < Trank; ++i)
   {
-    size_t row = Trank - step - 1;
-    result[row] = temp[row];
-    for (size_t column = row + 1; column < Trank; ++column)
-    {
-      result[row] -= this->upper[row][column] * result[column];
-    }
-    result[row] /= this->upper[row][row];
+    log_determinant += std::log(AbsoluteValue(data[i * Trank + i]));
   }
-  return tVector<Trank, TElement>(result);
+  return log_determinant;
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition Inverse
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const tMatrix<Trank, Trank, TElement> tLUDecomposition<Trank, TElement>::Inverse() const
+{
+  return this->Solve(tMatrix<Trank, Trank, TElement>::Identity());
+}
+
+//----------------------------------------------------------------------
+// tLUDecomposition EstimatedConditionNumber
+//----------------------------------------------------------------------
+template <size_t Trank, typename TElement>
+const TElement tLUDecomposition<Trank, TElement>::EstimatedConditionNumber() const
+{
+  // row swaps do not change the 1-norm of the inverse, so the estimate
+  // works on L * U directly
+  const TElement *data = reinterpret_cast<const TElement *>(&this->lu);
+  return this->norm * kernels::EstimateInverseOneNorm<Trank, TElement>([data](TElement * x)
+  {
+    kernels::LUSolve<Trank, 1>(data, static_cast<const size_t *>(nullptr), x);
+  },
+  [data](TElement * x)
+  {
+    kernels::LUTransposedSolve<Trank, 1>(data, static_cast<const size_t *>(nullptr), x);
+  });
 }
 
 //----------------------------------------------------------------------
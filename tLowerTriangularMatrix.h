@@ -0,0 +1,213 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tLowerTriangularMatrix.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tLowerTriangularMatrix
+ *
+ * \b tLowerTriangularMatrix
+ *
+ * A square lower triangular matrix in packed storage, e.g. to hold the
+ * factor of a Cholesky decomposition without wasting memory on the
+ * upper half that is always zero.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tLowerTriangularMatrix_h__
+#define __rrlib__math__tLowerTriangularMatrix_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A lower triangular matrix in packed storage
+/*!
+ * Only the Tdimension * (Tdimension + 1) / 2 elements on and below the
+ * diagonal are stored, row by row. Row r therefore starts at offset
+ * r * (r + 1) / 2 and contains r + 1 elements.
+ *
+ * The triangular solve kernels work directly on this format, so that
+ * factorizations stored this way never need to be expanded into full
+ * matrices to be used.
+ */
+template <size_t Tdimension, typename TElement = double>
+class tLowerTriangularMatrix
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  /*! The number of stored elements */
+  static const size_t cSIZE = Tdimension * (Tdimension + 1) / 2;
+
+  /*! Default ctor of tLowerTriangularMatrix
+   *
+   * Initializes with zero
+   */
+  tLowerTriangularMatrix();
+
+  /*! Conversion from a full matrix
+   *
+   * \param matrix   The full matrix whose lower triangle (including the diagonal) is copied
+   */
+  explicit tLowerTriangularMatrix(const tMatrix<Tdimension, Tdimension, TElement> &matrix);
+
+  /*! Access to the packed row \a row
+   *
+   * The returned row can be indexed with columns 0..row, which allows
+   * element access via triangular[row][column] for column <= row.
+   *
+   * \param row   The row to access
+   *
+   * \return Pointer to the first element of the packed row
+   */
+  inline const TElement *operator [](size_t row) const
+  {
+    return this->values + row * (row + 1) / 2;
+  }
+
+  inline TElement *operator [](size_t row)
+  {
+    return this->values + row * (row + 1) / 2;
+  }
+
+  /*! Expand into a full matrix with zeros above the diagonal
+   *
+   * \return The full matrix
+   */
+  const tMatrix<Tdimension, Tdimension, TElement> GetFullMatrix() const;
+
+  /*! Solve L * x = b by forward substitution
+   *
+   * \param right_side   The right-hand side b
+   *
+   * \return The solution x
+   */
+  const tVector<Tdimension, TElement> Solve(const tVector<Tdimension, TElement> &right_side) const;
+
+  /*! Solve L' * x = b by backward substitution
+   *
+   * \param right_side   The right-hand side b
+   *
+   * \return The solution x
+   */
+  const tVector<Tdimension, TElement> SolveTransposed(const tVector<Tdimension, TElement> &right_side) const;
+
+  /*! Solve L * X = B for multiple right-hand sides
+   *
+   * \param right_side   The matrix B whose columns are the right-hand sides
+   *
+   * \return The solution X
+   */
+  template <size_t Tcolumns>
+  const tMatrix<Tdimension, Tcolumns, TElement> Solve(const tMatrix<Tdimension, Tcolumns, TElement> &right_side) const;
+
+  /*! Solve L' * X = B for multiple right-hand sides
+   *
+   * \param right_side   The matrix B whose columns are the right-hand sides
+   *
+   * \return The solution X
+   */
+  template <size_t Tcolumns>
+  const tMatrix<Tdimension, Tcolumns, TElement> SolveTransposed(const tMatrix<Tdimension, Tcolumns, TElement> &right_side) const;
+
+  /*! Forward substitution kernel on raw row-major data
+   *
+   * Overwrites the Tdimension x Tcolumns row-major array \a data,
+   * holding the right-hand sides, with the solution of L * X = B.
+   *
+   * \param data   The right-hand sides that are replaced by the solution
+   */
+  template <size_t Tcolumns>
+  void SolveInPlace(TElement data[Tdimension * Tcolumns]) const;
+
+  /*! Backward substitution kernel on raw row-major data
+   *
+   * Overwrites the Tdimension x Tcolumns row-major array \a data,
+   * holding the right-hand sides, with the solution of L' * X = B.
+   *
+   * \param data   The right-hand sides that are replaced by the solution
+   */
+  template <size_t Tcolumns>
+  void SolveTransposedInPlace(TElement data[Tdimension * Tcolumns]) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TElement values[cSIZE];
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tLowerTriangularMatrix<2, float>;
+extern template class tLowerTriangularMatrix<3, float>;
+
+extern template class tLowerTriangularMatrix<2, double>;
+extern template class tLowerTriangularMatrix<3, double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tLowerTriangularMatrix.hpp"
+
+#endif
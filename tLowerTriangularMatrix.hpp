@@ -0,0 +1,168 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tLowerTriangularMatrix.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/decomposition_kernels.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix constructors
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+tLowerTriangularMatrix<Tdimension, TElement>::tLowerTriangularMatrix()
+{
+  std::memset(this->values, 0, sizeof(this->values));
+}
+
+template <size_t Tdimension, typename TElement>
+tLowerTriangularMatrix<Tdimension, TElement>::tLowerTriangularMatrix(const tMatrix<Tdimension, Tdimension, TElement> &matrix)
+{
+  const TElement *data = reinterpret_cast<const TElement *>(&matrix);
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    std::memcpy((*this)[row], data + row * Tdimension, (row + 1) * sizeof(TElement));
+  }
+}
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix GetFullMatrix
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+const tMatrix<Tdimension, Tdimension, TElement> tLowerTriangularMatrix<Tdimension, TElement>::GetFullMatrix() const
+{
+  TElement result[Tdimension * Tdimension];
+  std::memset(result, 0, sizeof(result));
+  for (size_t row = 0; row < Tdimension; ++row)
+  {
+    std::memcpy(result + row * Tdimension, (*this)[row], (row + 1) * sizeof(TElement));
+  }
+  return tMatrix<Tdimension, Tdimension, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix Solve
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+const tVector<Tdimension, TElement> tLowerTriangularMatrix<Tdimension, TElement>::Solve(const tVector<Tdimension, TElement> &right_side) const
+{
+  TElement result[Tdimension];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->SolveInPlace<1>(result);
+  return tVector<Tdimension, TElement>(result);
+}
+
+template <size_t Tdimension, typename TElement>
+template <size_t Tcolumns>
+const tMatrix<Tdimension, Tcolumns, TElement> tLowerTriangularMatrix<Tdimension, TElement>::Solve(const tMatrix<Tdimension, Tcolumns, TElement> &right_side) const
+{
+  TElement result[Tdimension * Tcolumns];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->SolveInPlace<Tcolumns>(result);
+  return tMatrix<Tdimension, Tcolumns, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix SolveTransposed
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+const tVector<Tdimension, TElement> tLowerTriangularMatrix<Tdimension, TElement>::SolveTransposed(const tVector<Tdimension, TElement> &right_side) const
+{
+  TElement result[Tdimension];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->SolveTransposedInPlace<1>(result);
+  return tVector<Tdimension, TElement>(result);
+}
+
+template <size_t Tdimension, typename TElement>
+template <size_t Tcolumns>
+const tMatrix<Tdimension, Tcolumns, TElement> tLowerTriangularMatrix<Tdimension, TElement>::SolveTransposed(const tMatrix<Tdimension, Tcolumns, TElement> &right_side) const
+{
+  TElement result[Tdimension * Tcolumns];
+  std::memcpy(result, &right_side, sizeof(result));
+  this->SolveTransposedInPlace<Tcolumns>(result);
+  return tMatrix<Tdimension, Tcolumns, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix SolveInPlace
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+template <size_t Tcolumns>
+void tLowerTriangularMatrix<Tdimension, TElement>::SolveInPlace(TElement data[Tdimension * Tcolumns]) const
+{
+  kernels::LowerTriangularSolve<Tdimension, Tcolumns>(this->values, data);
+}
+
+//----------------------------------------------------------------------
+// tLowerTriangularMatrix SolveTransposedInPlace
+//----------------------------------------------------------------------
+template <size_t Tdimension, typename TElement>
+template <size_t Tcolumns>
+void tLowerTriangularMatrix<Tdimension, TElement>::SolveTransposedInPlace(TElement data[Tdimension * Tcolumns]) const
+{
+  kernels::LowerTriangularTransposedSolve<Tdimension, Tcolumns>(this->values, data);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -123,4 +123,7 @@ extern template class tMatrix<4, 4, float>;
 }
 }
 
+// the rotation functionality converts via quaternions
+#include "rrlib/math/tQuaternion.h"
+
 #endif
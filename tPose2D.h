@@ -251,6 +251,16 @@ public:
     return tPose2D(tBase::Rotated(matrix));
   }
 
+  inline tPose2D &Rotate(const tSinCos<> &angle)
+  {
+    return this->Rotate(Get2DRotationMatrix<double>(angle));
+  }
+
+  inline tPose2D Rotated(const tSinCos<> &angle) const
+  {
+    return this->Rotated(Get2DRotationMatrix<double>(angle));
+  }
+
   inline tPose2D &Scale(double factor)
   {
     tBase::Scale(factor);
@@ -310,6 +310,16 @@ public:
     return tPose3D(tBase::Rotated(matrix));
   }
 
+  inline tPose3D &Rotate(const tSinCos<> &roll, const tSinCos<> &pitch, const tSinCos<> &yaw)
+  {
+    return this->Rotate(Get3DRotationMatrixFromRollPitchYaw<double>(roll, pitch, yaw));
+  }
+
+  inline tPose3D Rotated(const tSinCos<> &roll, const tSinCos<> &pitch, const tSinCos<> &yaw) const
+  {
+    return this->Rotated(Get3DRotationMatrixFromRollPitchYaw<double>(roll, pitch, yaw));
+  }
+
   inline tPose3D &Scale(double factor)
   {
     tBase::Scale(factor);
@@ -0,0 +1,362 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tQuaternion.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tQuaternion
+ *
+ * \b tQuaternion
+ *
+ * A quaternion w + x * i + y * j + z * k that represents a rotation in
+ * 3D space if it has unit length. Compared to rotation matrices, it
+ * needs 4 instead of 9 numbers and composition takes 16 instead of 27
+ * multiplications.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tQuaternion_h__
+#define __rrlib__math__tQuaternion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+#include "rrlib/serialization/serialization.h"
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tAngle.h"
+#include "rrlib/math/tSinCos.h"
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A quaternion for representing rotations
+/*!
+ * Conversions from and to rotation matrices, axis/angle and roll/pitch/yaw
+ * follow the conventions of Rotation<3, 3> and
+ * Get3DRotationMatrixFromRollPitchYaw, i.e. R = Rz(yaw) * Ry(pitch) * Rx(roll).
+ *
+ * The product a * b represents the rotation that first applies b and
+ * then a, just like the product of the corresponding matrices.
+ */
+template <typename TElement = double>
+class tQuaternion
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  /*! Default ctor of tQuaternion
+   *
+   * Initializes with the identity rotation
+   */
+  inline tQuaternion()
+    : w(1), x(0), y(0), z(0)
+  {}
+
+  /*! Ctor from components
+   *
+   * \param w   The real part
+   * \param x   The coefficient of i
+   * \param y   The coefficient of j
+   * \param z   The coefficient of k
+   */
+  inline tQuaternion(TElement w, TElement x, TElement y, TElement z)
+    : w(w), x(x), y(y), z(z)
+  {}
+
+  /*! Ctor from axis and angle
+   *
+   * \param axis    The rotation axis, which does not need to be normalized
+   * \param angle   The rotation angle
+   *
+   * \exception std::logic_error if \a axis has zero length
+   */
+  template <typename TVectorElement, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  tQuaternion(const tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> angle);
+
+  /*! Ctor from roll, pitch and yaw
+   *
+   * \param roll    The rotation around the x-axis
+   * \param pitch   The rotation around the y-axis
+   * \param yaw     The rotation around the z-axis
+   */
+  tQuaternion(tAngleRad roll, tAngleRad pitch, tAngleRad yaw);
+
+  /*! Ctor from axis and angle with precomputed sine and cosine
+   *
+   * The half angle is derived by tSinCos::Halved
+   *
+   * \param axis    The rotation axis, which does not need to be normalized
+   * \param angle   The rotation angle
+   *
+   * \exception std::logic_error if \a axis has zero length
+   */
+  template <typename TVectorElement, typename TSinCosElement>
+  tQuaternion(const tVector<3, TVectorElement, vector::Cartesian> &axis, const tSinCos<TSinCosElement> &angle);
+
+  /*! Ctor from roll, pitch and yaw with precomputed sine and cosine
+   *
+   * \param roll    The rotation around the x-axis
+   * \param pitch   The rotation around the y-axis
+   * \param yaw     The rotation around the z-axis
+   */
+  template <typename TSinCosElement>
+  tQuaternion(const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw);
+
+  /*! Ctor from a rotation matrix
+   *
+   * \param matrix   The orthogonal rotation matrix with det = 1
+   */
+  explicit tQuaternion(const tMatrix<3, 3, TElement> &matrix);
+
+  inline TElement W() const
+  {
+    return this->w;
+  }
+  inline TElement X() const
+  {
+    return this->x;
+  }
+  inline TElement Y() const
+  {
+    return this->y;
+  }
+  inline TElement Z() const
+  {
+    return this->z;
+  }
+
+  inline TElement SquaredNorm() const
+  {
+    return this->w * this->w + this->x * this->x + this->y * this->y + this->z * this->z;
+  }
+
+  inline TElement Norm() const
+  {
+    return std::sqrt(this->SquaredNorm());
+  }
+
+  void Normalize();
+
+  const tQuaternion Normalized() const;
+
+  /*! The conjugate of this quaternion
+   *
+   * For unit quaternions, this is the inverse rotation
+   *
+   * \return w - x * i - y * j - z * k
+   */
+  inline const tQuaternion Conjugated() const
+  {
+    return tQuaternion(this->w, -this->x, -this->y, -this->z);
+  }
+
+  const tQuaternion Inverted() const;
+
+  /*! Composition with another rotation
+   *
+   * \param other   The rotation that is applied before \a this one
+   *
+   * \return \a this quaternion
+   */
+  tQuaternion &operator *= (const tQuaternion &other);
+
+  /*! Rotate a vector without building a matrix
+   *
+   * Assumes that this quaternion has unit length
+   *
+   * \param vector   The vector to rotate
+   *
+   * \return The rotated vector
+   */
+  const tVector<3, TElement, vector::Cartesian> Rotate(const tVector<3, TElement, vector::Cartesian> &vector) const;
+
+  /*! Rotate an array of vectors
+   *
+   * \param vectors   The vectors to rotate
+   * \param result    The rotated vectors, which may be the same memory as \a vectors
+   * \param count     The number of vectors
+   */
+  void Rotate(const tVector<3, TElement, vector::Cartesian> *vectors, tVector<3, TElement, vector::Cartesian> *result, size_t count) const;
+
+  const tMatrix<3, 3, TElement> GetRotationMatrix() const;
+
+  template <typename TVectorElement, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void GetRotation(tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle) const;
+
+  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  void ExtractRollPitchYaw(tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &roll, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &pitch, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &yaw) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TElement w;
+  TElement x;
+  TElement y;
+  TElement z;
+
+};
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*! Composition of rotations
+ *
+ * \param left    The rotation that is applied last
+ * \param right   The rotation that is applied first
+ *
+ * \return The Hamilton product \a left * \a right
+ */
+template <typename TElement>
+inline const tQuaternion<TElement> operator * (const tQuaternion<TElement> &left, const tQuaternion<TElement> &right);
+
+template <typename TElement>
+inline bool IsEqual(const tQuaternion<TElement> &left, const tQuaternion<TElement> &right, float max_error = 1.0E-6, tFloatComparisonMethod method = eFCM_ABSOLUTE_ERROR);
+
+/*! Whether two unit quaternions represent the same rotation
+ *
+ * q and -q represent the same rotation, so both are compared
+ */
+template <typename TElement>
+bool IsEqualRotation(const tQuaternion<TElement> &left, const tQuaternion<TElement> &right, float max_error = 1.0E-6);
+
+/*! Spherical linear interpolation along the shorter arc
+ *
+ * \param first    The unit quaternion for \a factor = 0
+ * \param second   The unit quaternion for \a factor = 1
+ * \param factor   The interpolation parameter in [0, 1]
+ *
+ * \return The interpolated unit quaternion with constant angular velocity over \a factor
+ */
+template <typename TElement>
+const tQuaternion<TElement> Slerp(const tQuaternion<TElement> &first, const tQuaternion<TElement> &second, TElement factor);
+
+/*! Normalized linear interpolation along the shorter arc
+ *
+ * Cheaper than Slerp and with the same path, but the angular velocity is
+ * not constant over \a factor
+ *
+ * \param first    The unit quaternion for \a factor = 0
+ * \param second   The unit quaternion for \a factor = 1
+ * \param factor   The interpolation parameter in [0, 1]
+ *
+ * \return The interpolated unit quaternion
+ */
+template <typename TElement>
+const tQuaternion<TElement> Nlerp(const tQuaternion<TElement> &first, const tQuaternion<TElement> &second, TElement factor);
+
+/*! Compose arrays of rotations element-wise
+ *
+ * \param left     The rotations that are applied last
+ * \param right    The rotations that are applied first
+ * \param result   The composed rotations, which may be the same memory as one of the inputs
+ * \param count    The number of rotations
+ */
+template <typename TElement>
+void Multiply(const tQuaternion<TElement> *left, const tQuaternion<TElement> *right, tQuaternion<TElement> *result, size_t count);
+
+/*! Spherical linear interpolation of arrays of rotations element-wise
+ *
+ * \see Slerp
+ */
+template <typename TElement>
+void Slerp(const tQuaternion<TElement> *first, const tQuaternion<TElement> *second, TElement factor, tQuaternion<TElement> *result, size_t count);
+
+/*! Normalized linear interpolation of arrays of rotations element-wise
+ *
+ * \see Nlerp
+ */
+template <typename TElement>
+void Nlerp(const tQuaternion<TElement> *first, const tQuaternion<TElement> *second, TElement factor, tQuaternion<TElement> *result, size_t count);
+
+/*! Convert an array of quaternions into rotation matrices */
+template <typename TElement>
+void GetRotationMatrices(const tQuaternion<TElement> *quaternions, tMatrix<3, 3, TElement> *matrices, size_t count);
+
+/*! Convert an array of rotation matrices into quaternions */
+template <typename TElement>
+void GetQuaternions(const tMatrix<3, 3, TElement> *matrices, tQuaternion<TElement> *quaternions, size_t count);
+
+template <typename TElement>
+std::ostream &operator << (std::ostream &stream, const tQuaternion<TElement> &quaternion);
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternion<TElement> &quaternion);
+
+template <typename TElement>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternion<TElement> &quaternion);
+
+#endif
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tQuaternion<float>;
+extern template class tQuaternion<double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tQuaternion.hpp"
+
+#endif
@@ -0,0 +1,446 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tQuaternion.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/utilities.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tQuaternion constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+template <typename TVectorElement, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+tQuaternion<TElement>::tQuaternion(const tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> angle)
+{
+  const TVectorElement length = axis.Length();
+  if (length == 0)
+  {
+    throw std::logic_error("Invalid rotation axis (with zero length)");
+  }
+  TElement sine, cosine;
+  (angle / 2).SinCos(sine, cosine);
+  const TElement scale = sine / length;
+  this->w = cosine;
+  this->x = scale * axis[0];
+  this->y = scale * axis[1];
+  this->z = scale * axis[2];
+}
+
+template <typename TElement>
+template <typename TVectorElement, typename TSinCosElement>
+tQuaternion<TElement>::tQuaternion(const tVector<3, TVectorElement, vector::Cartesian> &axis, const tSinCos<TSinCosElement> &angle)
+{
+  const TVectorElement length = axis.Length();
+  if (length == 0)
+  {
+    throw std::logic_error("Invalid rotation axis (with zero length)");
+  }
+  const tSinCos<TSinCosElement> half_angle = angle.Halved();
+  const TElement scale = half_angle.Sine() / length;
+  this->w = half_angle.Cosine();
+  this->x = scale * axis[0];
+  this->y = scale * axis[1];
+  this->z = scale * axis[2];
+}
+
+template <typename TElement>
+template <typename TSinCosElement>
+tQuaternion<TElement>::tQuaternion(const tSinCos<TSinCosElement> &roll, const tSinCos<TSinCosElement> &pitch, const tSinCos<TSinCosElement> &yaw)
+{
+  const tSinCos<TSinCosElement> half_roll = roll.Halved();
+  const tSinCos<TSinCosElement> half_pitch = pitch.Halved();
+  const tSinCos<TSinCosElement> half_yaw = yaw.Halved();
+  const TSinCosElement sin_roll = half_roll.Sine(), cos_roll = half_roll.Cosine();
+  const TSinCosElement sin_pitch = half_pitch.Sine(), cos_pitch = half_pitch.Cosine();
+  const TSinCosElement sin_yaw = half_yaw.Sine(), cos_yaw = half_yaw.Cosine();
+  this->w = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+  this->x = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+  this->y = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+  this->z = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
+}
+
+template <typename TElement>
+tQuaternion<TElement>::tQuaternion(tAngleRad roll, tAngleRad pitch, tAngleRad yaw)
+{
+  double sin_roll, cos_roll;
+  (roll / 2).SinCos(sin_roll, cos_roll);
+  double sin_pitch, cos_pitch;
+  (pitch / 2).SinCos(sin_pitch, cos_pitch);
+  double sin_yaw, cos_yaw;
+  (yaw / 2).SinCos(sin_yaw, cos_yaw);
+  this->w = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+  this->x = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+  this->y = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+  this->z = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
+}
+
+template <typename TElement>
+tQuaternion<TElement>::tQuaternion(const tMatrix<3, 3, TElement> &matrix)
+{
+  // use the largest of w, x, y and z for the division to stay accurate
+  const TElement trace = matrix[0][0] + matrix[1][1] + matrix[2][2];
+  if (trace > 0)
+  {
+    const TElement s = 2 * std::sqrt(trace + 1);
+    this->w = s / 4;
+    this->x = (matrix[2][1] - matrix[1][2]) / s;
+    this->y = (matrix[0][2] - matrix[2][0]) / s;
+    this->z = (matrix[1][0] - matrix[0][1]) / s;
+  }
+  else if (matrix[0][0] >= matrix[1][1] && matrix[0][0] >= matrix[2][2])
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[0][0] - matrix[1][1] - matrix[2][2]);
+    this->w = (matrix[2][1] - matrix[1][2]) / s;
+    this->x = s / 4;
+    this->y = (matrix[0][1] + matrix[1][0]) / s;
+    this->z = (matrix[0][2] + matrix[2][0]) / s;
+  }
+  else if (matrix[1][1] >= matrix[2][2])
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[1][1] - matrix[0][0] - matrix[2][2]);
+    this->w = (matrix[0][2] - matrix[2][0]) / s;
+    this->x = (matrix[0][1] + matrix[1][0]) / s;
+    this->y = s / 4;
+    this->z = (matrix[1][2] + matrix[2][1]) / s;
+  }
+  else
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[2][2] - matrix[0][0] - matrix[1][1]);
+    this->w = (matrix[1][0] - matrix[0][1]) / s;
+    this->x = (matrix[0][2] + matrix[2][0]) / s;
+    this->y = (matrix[1][2] + matrix[2][1]) / s;
+    this->z = s / 4;
+  }
+}
+
+//----------------------------------------------------------------------
+// tQuaternion Normalize
+//----------------------------------------------------------------------
+template <typename TElement>
+void tQuaternion<TElement>::Normalize()
+{
+  const TElement norm = this->Norm();
+  assert(norm > 0);
+  this->w /= norm;
+  this->x /= norm;
+  this->y /= norm;
+  this->z /= norm;
+}
+
+//----------------------------------------------------------------------
+// tQuaternion Normalized
+//----------------------------------------------------------------------
+template <typename TElement>
+const tQuaternion<TElement> tQuaternion<TElement>::Normalized() const
+{
+  tQuaternion temp(*this);
+  temp.Normalize();
+  return temp;
+}
+
+//----------------------------------------------------------------------
+// tQuaternion Inverted
+//----------------------------------------------------------------------
+template <typename TElement>
+const tQuaternion<TElement> tQuaternion<TElement>::Inverted() const
+{
+  const TElement squared_norm = this->SquaredNorm();
+  assert(squared_norm > 0);
+  return tQuaternion(this->w / squared_norm, -this->x / squared_norm, -this->y / squared_norm, -this->z / squared_norm);
+}
+
+//----------------------------------------------------------------------
+// tQuaternion operator *=
+//----------------------------------------------------------------------
+template <typename TElement>
+tQuaternion<TElement> &tQuaternion<TElement>::operator *= (const tQuaternion &other)
+{
+  *this = *this * other;
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tQuaternion Rotate
+//----------------------------------------------------------------------
+template <typename TElement>
+const tVector<3, TElement, vector::Cartesian> tQuaternion<TElement>::Rotate(const tVector<3, TElement, vector::Cartesian> &vector) const
+{
+  // v' = v + w * t + q x t with t = 2 * q x v
+  const TElement t_x = 2 * (this->y * vector[2] - this->z * vector[1]);
+  const TElement t_y = 2 * (this->z * vector[0] - this->x * vector[2]);
+  const TElement t_z = 2 * (this->x * vector[1] - this->y * vector[0]);
+  return tVector<3, TElement, vector::Cartesian>(vector[0] + this->w * t_x + this->y * t_z - this->z * t_y,
+         vector[1] + this->w * t_y + this->z * t_x - this->x * t_z,
+         vector[2] + this->w * t_z + this->x * t_y - this->y * t_x);
+}
+
+template <typename TElement>
+void tQuaternion<TElement>::Rotate(const tVector<3, TElement, vector::Cartesian> *vectors, tVector<3, TElement, vector::Cartesian> *result, size_t count) const
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    result[i] = this->Rotate(vectors[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tQuaternion GetRotationMatrix
+//----------------------------------------------------------------------
+template <typename TElement>
+const tMatrix<3, 3, TElement> tQuaternion<TElement>::GetRotationMatrix() const
+{
+  const TElement xx = this->x * this->x;
+  const TElement yy = this->y * this->y;
+  const TElement zz = this->z * this->z;
+  const TElement xy = this->x * this->y;
+  const TElement xz = this->x * this->z;
+  const TElement yz = this->y * this->z;
+  const TElement wx = this->w * this->x;
+  const TElement wy = this->w * this->y;
+  const TElement wz = this->w * this->z;
+  return tMatrix<3, 3, TElement>(1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy),
+                                 2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx),
+                                 2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy));
+}
+
+//----------------------------------------------------------------------
+// tQuaternion GetRotation
+//----------------------------------------------------------------------
+template <typename TElement>
+template <typename TVectorElement, typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void tQuaternion<TElement>::GetRotation(tVector<3, TVectorElement, vector::Cartesian> &axis, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle) const
+{
+  const TElement sine = std::sqrt(this->x * this->x + this->y * this->y + this->z * this->z);
+  axis.Set(0, 0, 1);
+  angle = tAngleRad();
+  if (sine != 0)
+  {
+    axis.Set(this->x / sine, this->y / sine, this->z / sine);
+    angle = ATan2(sine, this->w) * 2;
+  }
+}
+
+//----------------------------------------------------------------------
+// tQuaternion ExtractRollPitchYaw
+//----------------------------------------------------------------------
+template <typename TElement>
+template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+void tQuaternion<TElement>::ExtractRollPitchYaw(tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &roll, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &pitch, tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &yaw) const
+{
+  roll = ATan2(2 * (this->w * this->x + this->y * this->z), 1 - 2 * (this->x * this->x + this->y * this->y));
+  pitch = ASin(std::max<TElement>(-1, std::min<TElement>(1, 2 * (this->w * this->y - this->z * this->x))));
+  yaw = ATan2(2 * (this->w * this->z + this->x * this->y), 1 - 2 * (this->y * this->y + this->z * this->z));
+}
+
+//----------------------------------------------------------------------
+// Arithmetic operators
+//----------------------------------------------------------------------
+template <typename TElement>
+const tQuaternion<TElement> operator * (const tQuaternion<TElement> &left, const tQuaternion<TElement> &right)
+{
+  return tQuaternion<TElement>(left.W() * right.W() - left.X() * right.X() - left.Y() * right.Y() - left.Z() * right.Z(),
+                               left.W() * right.X() + left.X() * right.W() + left.Y() * right.Z() - left.Z() * right.Y(),
+                               left.W() * right.Y() - left.X() * right.Z() + left.Y() * right.W() + left.Z() * right.X(),
+                               left.W() * right.Z() + left.X() * right.Y() - left.Y() * right.X() + left.Z() * right.W());
+}
+
+//----------------------------------------------------------------------
+// Comparison
+//----------------------------------------------------------------------
+template <typename TElement>
+bool IsEqual(const tQuaternion<TElement> &left, const tQuaternion<TElement> &right, float max_error, tFloatComparisonMethod method)
+{
+  return IsEqual(left.W(), right.W(), max_error, method) && IsEqual(left.X(), right.X(), max_error, method) &&
+         IsEqual(left.Y(), right.Y(), max_error, method) && IsEqual(left.Z(), right.Z(), max_error, method);
+}
+
+template <typename TElement>
+bool IsEqualRotation(const tQuaternion<TElement> &left, const tQuaternion<TElement> &right, float max_error)
+{
+  return IsEqual(left, right, max_error) || IsEqual(left, tQuaternion<TElement>(-right.W(), -right.X(), -right.Y(), -right.Z()), max_error);
+}
+
+//----------------------------------------------------------------------
+// Interpolation
+//----------------------------------------------------------------------
+template <typename TElement>
+const tQuaternion<TElement> Slerp(const tQuaternion<TElement> &first, const tQuaternion<TElement> &second, TElement factor)
+{
+  TElement cosine = first.W() * second.W() + first.X() * second.X() + first.Y() * second.Y() + first.Z() * second.Z();
+  TElement sign = 1;
+  if (cosine < 0)
+  {
+    cosine = -cosine;
+    sign = -1;
+  }
+
+  // for nearly equal rotations the weights below are numerically
+  // unstable but the linear interpolation is exact enough
+  if (cosine > TElement(0.9995))
+  {
+    return Nlerp(first, second, factor);
+  }
+
+  const TElement angle = std::acos(cosine);
+  const TElement inverse_sine = 1 / std::sin(angle);
+  const TElement first_weight = std::sin((1 - factor) * angle) * inverse_sine;
+  const TElement second_weight = sign * std::sin(factor * angle) * inverse_sine;
+  return tQuaternion<TElement>(first_weight * first.W() + second_weight * second.W(),
+                               first_weight * first.X() + second_weight * second.X(),
+                               first_weight * first.Y() + second_weight * second.Y(),
+                               first_weight * first.Z() + second_weight * second.Z());
+}
+
+template <typename TElement>
+const tQuaternion<TElement> Nlerp(const tQuaternion<TElement> &first, const tQuaternion<TElement> &second, TElement factor)
+{
+  const TElement cosine = first.W() * second.W() + first.X() * second.X() + first.Y() * second.Y() + first.Z() * second.Z();
+  const TElement first_weight = 1 - factor;
+  const TElement second_weight = cosine < 0 ? -factor : factor;
+  return tQuaternion<TElement>(first_weight * first.W() + second_weight * second.W(),
+                               first_weight * first.X() + second_weight * second.X(),
+                               first_weight * first.Y() + second_weight * second.Y(),
+                               first_weight * first.Z() + second_weight * second.Z()).Normalized();
+}
+
+//----------------------------------------------------------------------
+// Batch operations
+//----------------------------------------------------------------------
+template <typename TElement>
+void Multiply(const tQuaternion<TElement> *left, const tQuaternion<TElement> *right, tQuaternion<TElement> *result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    result[i] = left[i] * right[i];
+  }
+}
+
+template <typename TElement>
+void Slerp(const tQuaternion<TElement> *first, const tQuaternion<TElement> *second, TElement factor, tQuaternion<TElement> *result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    result[i] = Slerp(first[i], second[i], factor);
+  }
+}
+
+template <typename TElement>
+void Nlerp(const tQuaternion<TElement> *first, const tQuaternion<TElement> *second, TElement factor, tQuaternion<TElement> *result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    result[i] = Nlerp(first[i], second[i], factor);
+  }
+}
+
+template <typename TElement>
+void GetRotationMatrices(const tQuaternion<TElement> *quaternions, tMatrix<3, 3, TElement> *matrices, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    matrices[i] = quaternions[i].GetRotationMatrix();
+  }
+}
+
+template <typename TElement>
+void GetQuaternions(const tMatrix<3, 3, TElement> *matrices, tQuaternion<TElement> *quaternions, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    quaternions[i] = tQuaternion<TElement>(matrices[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+template <typename TElement>
+std::ostream &operator << (std::ostream &stream, const tQuaternion<TElement> &quaternion)
+{
+  return stream << "(" << quaternion.W() << ", " << quaternion.X() << ", " << quaternion.Y() << ", " << quaternion.Z() << ")";
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternion<TElement> &quaternion)
+{
+  stream << quaternion.W() << quaternion.X() << quaternion.Y() << quaternion.Z();
+  return stream;
+}
+
+template <typename TElement>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternion<TElement> &quaternion)
+{
+  TElement w, x, y, z;
+  stream >> w >> x >> y >> z;
+  quaternion = tQuaternion<TElement>(w, x, y, z);
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
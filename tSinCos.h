@@ -0,0 +1,270 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSinCos.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSinCos
+ *
+ * \b tSinCos
+ *
+ * An angle that carries its sine and cosine. They are computed once at
+ * construction, so code that uses the same heading many times (e.g. for
+ * transforming points with a pose) does not repeat the transcendental
+ * function calls. Sums, differences and half angles are derived from
+ * the stored values without calling sin and cos again.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tSinCos_h__
+#define __rrlib__math__tSinCos_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tAngle.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! An angle with cached sine and cosine
+/*!
+ * The rotation functions of tVector, tMatrix, tQuaternion and
+ * tVectorRotator accept tSinCos wherever they accept a rotation angle.
+ * Construction from a tAngle is explicit to keep overloads with tAngleRad
+ * unambiguous.
+ */
+template <typename TElement = double>
+class tSinCos
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+  typedef math::tAngle<TElement, angle::Radian, angle::Signed> tAngle;
+
+  /*! Default ctor of tSinCos
+   *
+   * Initializes with zero
+   */
+  inline tSinCos()
+    : angle(), sine(0), cosine(1)
+  {}
+
+  /*! Ctor from an angle
+   *
+   * \param angle   The angle whose sine and cosine are computed here
+   */
+  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy>
+  explicit inline tSinCos(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle)
+    : angle(angle)
+  {
+    this->angle.SinCos(this->sine, this->cosine);
+  }
+
+  /*! Ctor from an angle using a given trigonometry policy
+   *
+   * E.g. tSinCos<>(heading, angle::Polynomial<7>())
+   *
+   * \param angle   The angle whose sine and cosine are computed here
+   */
+  template <typename TAngleElement, typename TUnitPolicy, typename TAutoWrapPolicy, typename TTrigonometryPolicy>
+  inline tSinCos(const math::tAngle<TAngleElement, TUnitPolicy, TAutoWrapPolicy> &angle, const TTrigonometryPolicy &)
+    : angle(angle)
+  {
+    this->angle.template SinCos<TTrigonometryPolicy>(this->sine, this->cosine);
+  }
+
+  /*! Ctor from sine and cosine
+   *
+   * The values only need to be proportional to sine and cosine, e.g. the
+   * components of a direction vector. They are normalized here.
+   *
+   * \param sine     The (scaled) sine
+   * \param cosine   The (scaled) cosine
+   *
+   * \exception std::logic_error if both values are zero
+   */
+  inline tSinCos(TElement sine, TElement cosine)
+  {
+    TElement length = std::sqrt(sine * sine + cosine * cosine);
+    if (length == 0)
+    {
+      throw std::logic_error("Sine and cosine must not both be zero");
+    }
+    this->sine = sine / length;
+    this->cosine = cosine / length;
+    this->angle = tAngle(std::atan2(this->sine, this->cosine));
+  }
+
+  inline const tAngle &Angle() const
+  {
+    return this->angle;
+  }
+
+  inline TElement Sine() const
+  {
+    return this->sine;
+  }
+
+  inline TElement Cosine() const
+  {
+    return this->cosine;
+  }
+
+  inline TElement Tangent() const
+  {
+    return this->sine / this->cosine;
+  }
+
+  template <typename T>
+  inline void SinCos(T &sine, T &cosine) const
+  {
+    sine = this->sine;
+    cosine = this->cosine;
+  }
+
+  /*! Half of this angle
+   *
+   * Uses the half-angle formulas, i.e. a square root and a division instead
+   * of sine and cosine. Needed e.g. for quaternions.
+   *
+   * \return The half angle with its sine and cosine
+   */
+  inline tSinCos Halved() const
+  {
+    // the signed angle is in [-pi, pi), so the half angle has a non-negative cosine.
+    // The square root is always taken of the larger one of (1 +- cosine) / 2 to avoid cancellation.
+    tSinCos result;
+    result.angle = this->angle / 2;
+    if (this->cosine >= 0)
+    {
+      result.cosine = std::sqrt((1 + this->cosine) / 2);
+      result.sine = this->sine / (2 * result.cosine);
+    }
+    else
+    {
+      // the sign follows the angle, which also decides between -pi and pi for a zero sine
+      result.sine = std::copysign(std::sqrt((1 - this->cosine) / 2), this->angle.Value());
+      result.cosine = this->sine / (2 * result.sine);
+    }
+    return result;
+  }
+
+  inline tSinCos &operator += (const tSinCos &other)
+  {
+    TElement sine = this->sine * other.cosine + this->cosine * other.sine;
+    this->cosine = this->cosine * other.cosine - this->sine * other.sine;
+    this->sine = sine;
+    this->angle += other.angle;
+    return *this;
+  }
+
+  inline tSinCos &operator -= (const tSinCos &other)
+  {
+    TElement sine = this->sine * other.cosine - this->cosine * other.sine;
+    this->cosine = this->cosine * other.cosine + this->sine * other.sine;
+    this->sine = sine;
+    this->angle -= other.angle;
+    return *this;
+  }
+
+  inline tSinCos operator - () const
+  {
+    tSinCos result(*this);
+    result.angle = -this->angle;
+    result.sine = -this->sine;
+    return result;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tAngle angle;
+  TElement sine;
+  TElement cosine;
+
+};
+
+//----------------------------------------------------------------------
+// Arithmetic operators
+//----------------------------------------------------------------------
+
+template <typename TElement>
+inline tSinCos<TElement> operator + (tSinCos<TElement> left, const tSinCos<TElement> &right)
+{
+  return left += right;
+}
+
+template <typename TElement>
+inline tSinCos<TElement> operator - (tSinCos<TElement> left, const tSinCos<TElement> &right)
+{
+  return left -= right;
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+
+template <typename TElement>
+std::ostream &operator << (std::ostream &stream, const tSinCos<TElement> &angle)
+{
+  return stream << angle.Angle();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
@@ -0,0 +1,210 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSingularValueDecomposition.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSingularValueDecomposition
+ *
+ * \b tSingularValueDecomposition
+ *
+ * The singular value decomposition A = U * S * V' of a fixed-size
+ * matrix, computed by one-sided Jacobi rotations. All data lives in
+ * the object itself, so that decomposing does not allocate memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tSingularValueDecomposition_h__
+#define __rrlib__math__tSingularValueDecomposition_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Singular value decomposition of fixed-size matrices
+/*! Decomposes a Trows x Tcolumns matrix A into A = U * S * V' with the
+ *  cRANK = min(Trows, Tcolumns) columns of U, the descending singular
+ *  values S and the full orthogonal Tcolumns x Tcolumns matrix V.
+ *
+ *  The columns of A are orthogonalized by Jacobi rotations that are
+ *  accumulated in V (Hestenes' method), which is accurate even for
+ *  small singular values and needs no bidiagonalization.
+ *
+ *  Tolerances below which singular values are treated as zero default
+ *  to max(Trows, Tcolumns) * epsilon * largest singular value.
+ */
+template <size_t Trows, size_t Tcolumns, typename TElement = double>
+class tSingularValueDecomposition
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  static const size_t cRANK = Trows < Tcolumns ? Trows : Tcolumns;
+
+  tSingularValueDecomposition(const tMatrix<Trows, Tcolumns, TElement> &matrix);
+
+  /*! The left singular vectors
+   *
+   * \return The matrix whose columns are the left singular vectors. Columns belonging to zero singular values are zero.
+   */
+  inline const tMatrix<Trows, cRANK, TElement> &U() const
+  {
+    return this->u;
+  }
+
+  /*! The singular values in descending order
+   *
+   * \return The vector of the cRANK singular values
+   */
+  inline const tVector<cRANK, TElement> &SingularValues() const
+  {
+    return this->singular_values;
+  }
+
+  /*! The right singular vectors
+   *
+   * \return The orthogonal matrix whose columns are the right singular vectors, completed by a basis of the null space
+   */
+  inline const tMatrix<Tcolumns, Tcolumns, TElement> &V() const
+  {
+    return this->v;
+  }
+
+  /*! The default tolerance below which singular values are treated as zero
+   *
+   * \return max(Trows, Tcolumns) * epsilon * largest singular value
+   */
+  const TElement DefaultTolerance() const;
+
+  /*! The numerical rank of the decomposed matrix
+   *
+   * \param tolerance   Singular values up to this value are treated as zero
+   *
+   * \return The number of singular values above \a tolerance
+   */
+  const size_t Rank(TElement tolerance) const;
+
+  inline const size_t Rank() const
+  {
+    return this->Rank(this->DefaultTolerance());
+  }
+
+  /*! The Moore-Penrose pseudo-inverse of the decomposed matrix
+   *
+   * \param tolerance   Singular values up to this value are treated as zero
+   *
+   * \return V * S^+ * U'
+   */
+  const tMatrix<Tcolumns, Trows, TElement> PseudoInverse(TElement tolerance) const;
+
+  inline const tMatrix<Tcolumns, Trows, TElement> PseudoInverse() const
+  {
+    return this->PseudoInverse(this->DefaultTolerance());
+  }
+
+  /*! An orthonormal basis of the null space of the decomposed matrix
+   *
+   * \param basis       The matrix whose leading columns are set to the basis vectors. The remaining columns are zero.
+   * \param tolerance   Singular values up to this value are treated as zero
+   *
+   * \return The dimension of the null space
+   */
+  const size_t NullSpace(tMatrix<Tcolumns, Tcolumns, TElement> &basis, TElement tolerance) const;
+
+  inline const size_t NullSpace(tMatrix<Tcolumns, Tcolumns, TElement> &basis) const
+  {
+    return this->NullSpace(basis, this->DefaultTolerance());
+  }
+
+  /*! The right singular vectors of the Tdimension smallest singular values
+   *
+   * Meant for problems with a null space of known dimension, e.g. the
+   * self-motion of a redundant manipulator
+   *
+   * \return The matrix with the last Tdimension columns of V
+   */
+  template <size_t Tdimension>
+  const tMatrix<Tcolumns, Tdimension, TElement> NullSpace() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static const size_t cMAX_JACOBI_SWEEPS = 30;
+
+  tMatrix<Trows, cRANK, TElement> u;
+  tVector<cRANK, TElement> singular_values;
+  tMatrix<Tcolumns, Tcolumns, TElement> v;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tSingularValueDecomposition<2, 2, float>;
+extern template class tSingularValueDecomposition<3, 3, float>;
+
+extern template class tSingularValueDecomposition<2, 2, double>;
+extern template class tSingularValueDecomposition<3, 3, double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tSingularValueDecomposition.hpp"
+
+#endif
@@ -0,0 +1,272 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSingularValueDecomposition.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/utilities.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tSingularValueDecomposition constructors
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Tcolumns, typename TElement>
+tSingularValueDecomposition<Trows, Tcolumns, TElement>::tSingularValueDecomposition(const tMatrix<Trows, Tcolumns, TElement> &matrix)
+{
+  TElement w[Trows * Tcolumns];
+  TElement v[Tcolumns * Tcolumns];
+  std::memcpy(w, &matrix, sizeof(w));
+  std::memset(v, 0, sizeof(v));
+  for (size_t i = 0; i < Tcolumns; ++i)
+  {
+    v[i * Tcolumns + i] = 1;
+  }
+
+  // rotate pairs of columns of W = A * V until all are orthogonal
+  const TElement epsilon = std::numeric_limits<TElement>::epsilon();
+  for (size_t sweep = 0; sweep < cMAX_JACOBI_SWEEPS; ++sweep)
+  {
+    bool rotated = false;
+    for (size_t p = 0; p + 1 < Tcolumns; ++p)
+    {
+      for (size_t q = p + 1; q < Tcolumns; ++q)
+      {
+        TElement alpha = 0;
+        TElement beta = 0;
+        TElement gamma = 0;
+        for (size_t row = 0; row < Trows; ++row)
+        {
+          alpha += w[row * Tcolumns + p] * w[row * Tcolumns + p];
+          beta += w[row * Tcolumns + q] * w[row * Tcolumns + q];
+          gamma += w[row * Tcolumns + p] * w[row * Tcolumns + q];
+        }
+        if (gamma == 0 || AbsoluteValue(gamma) <= epsilon * std::sqrt(alpha * beta))
+        {
+          continue;
+        }
+        rotated = true;
+
+        const TElement zeta = (beta - alpha) / (2 * gamma);
+        const TElement tangent = (zeta < 0 ? -1 : 1) / (AbsoluteValue(zeta) + std::sqrt(1 + zeta * zeta));
+        const TElement cosine = 1 / std::sqrt(1 + tangent * tangent);
+        const TElement sine = cosine * tangent;
+        for (size_t row = 0; row < Trows; ++row)
+        {
+          const TElement w_p = w[row * Tcolumns + p];
+          const TElement w_q = w[row * Tcolumns + q];
+          w[row * Tcolumns + p] = cosine * w_p - sine * w_q;
+          w[row * Tcolumns + q] = sine * w_p + cosine * w_q;
+        }
+        for (size_t row = 0; row < Tcolumns; ++row)
+        {
+          const TElement v_p = v[row * Tcolumns + p];
+          const TElement v_q = v[row * Tcolumns + q];
+          v[row * Tcolumns + p] = cosine * v_p - sine * v_q;
+          v[row * Tcolumns + q] = sine * v_p + cosine * v_q;
+        }
+      }
+    }
+    if (!rotated)
+    {
+      break;
+    }
+  }
+
+  // the singular values are the norms of the orthogonal columns
+  TElement norms[Tcolumns];
+  size_t order[Tcolumns];
+  for (size_t column = 0; column < Tcolumns; ++column)
+  {
+    TElement sum = 0;
+    for (size_t row = 0; row < Trows; ++row)
+    {
+      sum += w[row * Tcolumns + column] * w[row * Tcolumns + column];
+    }
+    norms[column] = std::sqrt(sum);
+    order[column] = column;
+  }
+  std::sort(order, order + Tcolumns, [&norms](size_t a, size_t b)
+  {
+    return norms[a] > norms[b];
+  });
+
+  TElement u_data[Trows * cRANK];
+  TElement singular_value_data[cRANK];
+  TElement v_data[Tcolumns * Tcolumns];
+  for (size_t i = 0; i < Tcolumns; ++i)
+  {
+    const size_t column = order[i];
+    for (size_t row = 0; row < Tcolumns; ++row)
+    {
+      v_data[row * Tcolumns + i] = v[row * Tcolumns + column];
+    }
+    if (i >= cRANK)
+    {
+      continue;
+    }
+    singular_value_data[i] = norms[column];
+    const TElement inverse_norm = norms[column] > 0 ? 1 / norms[column] : 0;
+    for (size_t row = 0; row < Trows; ++row)
+    {
+      u_data[row * cRANK + i] = w[row * Tcolumns + column] * inverse_norm;
+    }
+  }
+  this->u = tMatrix<Trows, cRANK, TElement>(u_data);
+  this->singular_values = tVector<cRANK, TElement>(singular_value_data);
+  this->v = tMatrix<Tcolumns, Tcolumns, TElement>(v_data);
+}
+
+//----------------------------------------------------------------------
+// tSingularValueDecomposition DefaultTolerance
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Tcolumns, typename TElement>
+const TElement tSingularValueDecomposition<Trows, Tcolumns, TElement>::DefaultTolerance() const
+{
+  return std::max(Trows, Tcolumns) * std::numeric_limits<TElement>::epsilon() * this->singular_values[0];
+}
+
+//----------------------------------------------------------------------
+// tSingularValueDecomposition Rank
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Tcolumns, typename TElement>
+const size_t tSingularValueDecomposition<Trows, Tcolumns, TElement>::Rank(TElement tolerance) const
+{
+  size_t rank = 0;
+  while (rank < cRANK && this->singular_values[rank] > tolerance)
+  {
+    ++rank;
+  }
+  return rank;
+}
+
+//----------------------------------------------------------------------
+// tSingularValueDecomposition PseudoInverse
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Tcolumns, typename TElement>
+const tMatrix<Tcolumns, Trows, TElement> tSingularValueDecomposition<Trows, Tcolumns, TElement>::PseudoInverse(TElement tolerance) const
+{
+  const size_t rank = this->Rank(tolerance);
+  const TElement *u = reinterpret_cast<const TElement *>(&this->u);
+  const TElement *v = reinterpret_cast<const TElement *>(&this->v);
+
+  TElement result[Tcolumns * Trows];
+  std::memset(result, 0, sizeof(result));
+  for (size_t i = 0; i < rank; ++i)
+  {
+    const TElement inverse_singular_value = 1 / this->singular_values[i];
+    for (size_t row = 0; row < Tcolumns; ++row)
+    {
+      const TElement factor = v[row * Tcolumns + i] * inverse_singular_value;
+      for (size_t column = 0; column < Trows; ++column)
+      {
+        result[row * Trows + column] += factor * u[column * cRANK + i];
+      }
+    }
+  }
+  return tMatrix<Tcolumns, Trows, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// tSingularValueDecomposition NullSpace
+//----------------------------------------------------------------------
+template <size_t Trows, size_t Tcolumns, typename TElement>
+const size_t tSingularValueDecomposition<Trows, Tcolumns, TElement>::NullSpace(tMatrix<Tcolumns, Tcolumns, TElement> &basis, TElement tolerance) const
+{
+  const size_t rank = this->Rank(tolerance);
+  const TElement *v = reinterpret_cast<const TElement *>(&this->v);
+
+  TElement result[Tcolumns * Tcolumns];
+  std::memset(result, 0, sizeof(result));
+  for (size_t row = 0; row < Tcolumns; ++row)
+  {
+    for (size_t column = rank; column < Tcolumns; ++column)
+    {
+      result[row * Tcolumns + column - rank] = v[row * Tcolumns + column];
+    }
+  }
+  basis = tMatrix<Tcolumns, Tcolumns, TElement>(result);
+  return Tcolumns - rank;
+}
+
+template <size_t Trows, size_t Tcolumns, typename TElement>
+template <size_t Tdimension>
+const tMatrix<Tcolumns, Tdimension, TElement> tSingularValueDecomposition<Trows, Tcolumns, TElement>::NullSpace() const
+{
+  static_assert(Tdimension <= Tcolumns, "Null space can not be larger than the domain");
+
+  const TElement *v = reinterpret_cast<const TElement *>(&this->v);
+  TElement result[Tcolumns * Tdimension];
+  for (size_t row = 0; row < Tcolumns; ++row)
+  {
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      result[row * Tdimension + column] = v[row * Tcolumns + Tcolumns - Tdimension + column];
+    }
+  }
+  return tMatrix<Tcolumns, Tdimension, TElement>(result);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
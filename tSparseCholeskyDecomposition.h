@@ -0,0 +1,249 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSparseCholeskyDecomposition.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSparseCholeskyDecomposition
+ *
+ * \b tSparseCholeskyDecomposition
+ *
+ * Cholesky decomposition P * A * P' = L * L' of a large, sparse,
+ * symmetric positive definite matrix A. The permutation P reduces the
+ * fill-in of L and is chosen by a minimum degree ordering.
+ *
+ * Everything that only depends on the sparsity pattern of A is kept in
+ * a tSymbolicAnalysis. Problems whose pattern stays the same, e.g. the
+ * iterations of a least squares solver on a pose graph, therefore only
+ * pay for the numeric factorization after the first one.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tSparseCholeskyDecomposition_h__
+#define __rrlib__math__tSparseCholeskyDecomposition_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tSparseMatrix.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Simplicial Cholesky decomposition of a sparse matrix
+/*!
+ * The matrix to decompose must store both of its triangles. The factor
+ * L is kept in compressed sparse column format with the diagonal
+ * element first in each column.
+ */
+template <typename TElement = double>
+class tSparseCholeskyDecomposition
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  //! The part of the decomposition that only depends on the sparsity pattern
+  class tSymbolicAnalysis
+  {
+  public:
+
+    /*! Analyze a pattern using a minimum degree ordering
+     *
+     * \param matrix       The matrix whose pattern is analyzed
+     * \param block_size   Consecutive groups of this many rows and columns are kept together by the ordering. Computing the ordering on the blocks of e.g. pose graphs is much cheaper and hardly produces more fill-in.
+     */
+    explicit tSymbolicAnalysis(const tSparseMatrix<TElement> &matrix, size_t block_size = 1);
+
+    /*! Analyze a pattern using a given ordering
+     *
+     * \param matrix        The matrix whose pattern is analyzed
+     * \param permutation   The ordering, i.e. row k of P * A * P' is row permutation[k] of A
+     */
+    tSymbolicAnalysis(const tSparseMatrix<TElement> &matrix, const std::vector<size_t> &permutation);
+
+    inline size_t GetDimension() const
+    {
+      return this->permutation.size();
+    }
+
+    inline const std::vector<size_t> &GetPermutation() const
+    {
+      return this->permutation;
+    }
+
+    /*! The parent of every column of L in the elimination tree, or GetDimension() for roots */
+    inline const std::vector<size_t> &GetEliminationTree() const
+    {
+      return this->parent;
+    }
+
+    /*! The number of elements of L that are not structurally zero */
+    inline size_t GetNumberOfNonZeros() const
+    {
+      return this->column_offsets.back();
+    }
+
+  private:
+
+    friend class tSparseCholeskyDecomposition;
+
+    std::vector<size_t> permutation;
+    std::vector<size_t> inverse_permutation;
+    std::vector<size_t> parent;
+    std::vector<size_t> column_offsets;
+
+    void Analyze(const tSparseMatrix<TElement> &matrix);
+
+  };
+
+  /*! Minimum degree ordering of a symmetric pattern
+   *
+   * Repeatedly eliminates a node of minimum degree from the explicit
+   * elimination graph of the pattern.
+   *
+   * \param matrix       The matrix whose pattern is ordered
+   * \param block_size   The number of consecutive rows and columns that are treated as one node of the graph
+   *
+   * \return The ordering, i.e. row k of P * A * P' is row result[k] of A
+   */
+  static const std::vector<size_t> MinimumDegreeOrdering(const tSparseMatrix<TElement> &matrix, size_t block_size = 1);
+
+  /*! Analyze and factorize a matrix
+   *
+   * \param matrix   The symmetric positive definite matrix to decompose
+   *
+   * \exception std::logic_error if \a matrix is not positive definite
+   */
+  explicit tSparseCholeskyDecomposition(const tSparseMatrix<TElement> &matrix);
+
+  /*! Factorize a matrix reusing an existing analysis
+   *
+   * \param analysis   The symbolic analysis of a matrix with the same pattern as \a matrix
+   * \param matrix     The symmetric positive definite matrix to decompose
+   *
+   * \exception std::logic_error if \a matrix is not positive definite or its pattern does not match \a analysis
+   */
+  tSparseCholeskyDecomposition(const tSymbolicAnalysis &analysis, const tSparseMatrix<TElement> &matrix);
+
+  /*! Factorize a new matrix with the pattern this decomposition was analyzed for
+   *
+   * \param matrix   The symmetric positive definite matrix to decompose
+   *
+   * \exception std::logic_error if \a matrix is not positive definite or its pattern does not match the analysis. The previous factorization is kept in that case.
+   */
+  void Factorize(const tSparseMatrix<TElement> &matrix);
+
+  inline const tSymbolicAnalysis &GetSymbolicAnalysis() const
+  {
+    return this->analysis;
+  }
+
+  inline const std::vector<size_t> &GetColumnOffsets() const
+  {
+    return this->analysis.column_offsets;
+  }
+
+  inline const std::vector<size_t> &GetRowIndices() const
+  {
+    return this->row_indices;
+  }
+
+  inline const std::vector<TElement> &GetValues() const
+  {
+    return this->values;
+  }
+
+  /*! Solve A * x = b
+   *
+   * \param right_side   The GetDimension() elements of b
+   * \param solution     The GetDimension() elements of x. May be the same as \a right_side.
+   */
+  void Solve(const TElement *right_side, TElement *solution) const;
+
+  /*! Solve A * x = b
+   *
+   * \param right_side   The right-hand side b
+   *
+   * \return The solution x
+   */
+  const std::vector<TElement> Solve(const std::vector<TElement> &right_side) const;
+
+  /*! The natural logarithm of the determinant of the decomposed matrix
+   *
+   * \return log(det(A))
+   */
+  const TElement LogDeterminant() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tSymbolicAnalysis analysis;
+  std::vector<size_t> row_indices;
+  std::vector<TElement> values;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tSparseCholeskyDecomposition<float>;
+extern template class tSparseCholeskyDecomposition<double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tSparseCholeskyDecomposition.hpp"
+
+#endif
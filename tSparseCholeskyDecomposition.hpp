@@ -0,0 +1,442 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSparseCholeskyDecomposition.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+#include <iterator>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+/*! The pattern of row k of L
+ *
+ * The pattern consists of all nodes of the elimination tree that lie on
+ * the paths from the columns of row k of P * A * P' up to k. It is
+ * stored in topological order at stack[top] to stack[n - 1], where top
+ * is the return value. marker must not contain k before the call.
+ */
+template <typename TElement>
+size_t SparseCholeskyRowPattern(const tSparseMatrix<TElement> &matrix, const std::vector<size_t> &permutation, const std::vector<size_t> &inverse_permutation,
+                                const std::vector<size_t> &parent, size_t k, std::vector<size_t> &stack, std::vector<size_t> &marker)
+{
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  const size_t row = permutation[k];
+
+  size_t top = permutation.size();
+  marker[k] = k;
+  for (size_t i = row_offsets[row]; i < row_offsets[row + 1]; ++i)
+  {
+    size_t node = inverse_permutation[column_indices[i]];
+    if (node > k)
+    {
+      continue;
+    }
+    size_t length = 0;
+    // the walk only ends at a root for patterns the analysis was not done for
+    for (; node < permutation.size() && marker[node] != k; node = parent[node])
+    {
+      stack[length++] = node;
+      marker[node] = k;
+    }
+    while (length > 0)
+    {
+      stack[--top] = stack[--length];
+    }
+  }
+  return top;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition::tSymbolicAnalysis constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+tSparseCholeskyDecomposition<TElement>::tSymbolicAnalysis::tSymbolicAnalysis(const tSparseMatrix<TElement> &matrix, size_t block_size)
+  : permutation(tSparseCholeskyDecomposition::MinimumDegreeOrdering(matrix, block_size))
+{
+  this->Analyze(matrix);
+}
+
+template <typename TElement>
+tSparseCholeskyDecomposition<TElement>::tSymbolicAnalysis::tSymbolicAnalysis(const tSparseMatrix<TElement> &matrix, const std::vector<size_t> &permutation)
+  : permutation(permutation)
+{
+  this->Analyze(matrix);
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition::tSymbolicAnalysis Analyze
+//----------------------------------------------------------------------
+template <typename TElement>
+void tSparseCholeskyDecomposition<TElement>::tSymbolicAnalysis::Analyze(const tSparseMatrix<TElement> &matrix)
+{
+  const size_t n = this->permutation.size();
+  if (matrix.GetNumberOfRows() != n || matrix.GetNumberOfColumns() != n)
+  {
+    throw std::logic_error("Permutation does not match matrix dimension!");
+  }
+
+  this->inverse_permutation.assign(n, n);
+  for (size_t k = 0; k < n; ++k)
+  {
+    if (this->permutation[k] >= n || this->inverse_permutation[this->permutation[k]] != n)
+    {
+      throw std::logic_error("Invalid permutation!");
+    }
+    this->inverse_permutation[this->permutation[k]] = k;
+  }
+
+  // elimination tree via path compressed ancestors
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  this->parent.assign(n, n);
+  std::vector<size_t> ancestor(n, n);
+  for (size_t k = 0; k < n; ++k)
+  {
+    const size_t row = this->permutation[k];
+    for (size_t i = row_offsets[row]; i < row_offsets[row + 1]; ++i)
+    {
+      size_t next = n;
+      for (size_t node = this->inverse_permutation[column_indices[i]]; node < k; node = next)
+      {
+        next = ancestor[node];
+        ancestor[node] = k;
+        if (next == n)
+        {
+          this->parent[node] = k;
+        }
+      }
+    }
+  }
+
+  // column counts of L from the row patterns
+  std::vector<size_t> counts(n, 1);
+  std::vector<size_t> stack(n);
+  std::vector<size_t> marker(n, n);
+  for (size_t k = 0; k < n; ++k)
+  {
+    const size_t top = SparseCholeskyRowPattern(matrix, this->permutation, this->inverse_permutation, this->parent, k, stack, marker);
+    for (size_t i = top; i < n; ++i)
+    {
+      counts[stack[i]]++;
+    }
+  }
+
+  this->column_offsets.assign(n + 1, 0);
+  for (size_t k = 0; k < n; ++k)
+  {
+    this->column_offsets[k + 1] = this->column_offsets[k] + counts[k];
+  }
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition MinimumDegreeOrdering
+//----------------------------------------------------------------------
+template <typename TElement>
+const std::vector<size_t> tSparseCholeskyDecomposition<TElement>::MinimumDegreeOrdering(const tSparseMatrix<TElement> &matrix, size_t block_size)
+{
+  const size_t n = matrix.GetNumberOfRows();
+  if (matrix.GetNumberOfColumns() != n || block_size == 0 || n % block_size != 0)
+  {
+    throw std::logic_error("Matrix can not be ordered in blocks of given size!");
+  }
+  const size_t number_of_nodes = n / block_size;
+
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  std::vector<std::vector<size_t>> adjacency(number_of_nodes);
+  for (size_t row = 0; row < n; ++row)
+  {
+    for (size_t i = row_offsets[row]; i < row_offsets[row + 1]; ++i)
+    {
+      const size_t u = row / block_size;
+      const size_t v = column_indices[i] / block_size;
+      if (u != v)
+      {
+        adjacency[u].push_back(v);
+        adjacency[v].push_back(u);
+      }
+    }
+  }
+
+  std::set<std::pair<size_t, size_t>> queue;
+  for (size_t u = 0; u < number_of_nodes; ++u)
+  {
+    std::sort(adjacency[u].begin(), adjacency[u].end());
+    adjacency[u].erase(std::unique(adjacency[u].begin(), adjacency[u].end()), adjacency[u].end());
+    queue.insert(std::make_pair(adjacency[u].size(), u));
+  }
+
+  // eliminating a node connects all of its neighbors
+  std::vector<size_t> ordering;
+  ordering.reserve(n);
+  std::vector<size_t> merged;
+  while (!queue.empty())
+  {
+    const size_t node = queue.begin()->second;
+    queue.erase(queue.begin());
+    for (size_t i = 0; i < block_size; ++i)
+    {
+      ordering.push_back(node * block_size + i);
+    }
+
+    std::vector<size_t> neighbors;
+    neighbors.swap(adjacency[node]);
+    for (auto it = neighbors.begin(); it != neighbors.end(); ++it)
+    {
+      const size_t u = *it;
+      queue.erase(std::make_pair(adjacency[u].size(), u));
+      merged.clear();
+      std::set_union(adjacency[u].begin(), adjacency[u].end(), neighbors.begin(), neighbors.end(), std::back_inserter(merged));
+      merged.erase(std::remove_if(merged.begin(), merged.end(), [node, u](size_t v)
+      {
+        return v == node || v == u;
+      }), merged.end());
+      adjacency[u].swap(merged);
+      queue.insert(std::make_pair(adjacency[u].size(), u));
+    }
+  }
+
+  return ordering;
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+tSparseCholeskyDecomposition<TElement>::tSparseCholeskyDecomposition(const tSparseMatrix<TElement> &matrix)
+  : analysis(matrix)
+{
+  this->Factorize(matrix);
+}
+
+template <typename TElement>
+tSparseCholeskyDecomposition<TElement>::tSparseCholeskyDecomposition(const tSymbolicAnalysis &analysis, const tSparseMatrix<TElement> &matrix)
+  : analysis(analysis)
+{
+  this->Factorize(matrix);
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition Factorize
+//----------------------------------------------------------------------
+template <typename TElement>
+void tSparseCholeskyDecomposition<TElement>::Factorize(const tSparseMatrix<TElement> &matrix)
+{
+  const size_t n = this->analysis.GetDimension();
+  if (matrix.GetNumberOfRows() != n || matrix.GetNumberOfColumns() != n)
+  {
+    throw std::logic_error("Matrix does not match symbolic analysis!");
+  }
+
+  const std::vector<size_t> &permutation = this->analysis.permutation;
+  const std::vector<size_t> &inverse_permutation = this->analysis.inverse_permutation;
+  const std::vector<size_t> &column_offsets = this->analysis.column_offsets;
+  const std::vector<size_t> &row_offsets = matrix.GetRowOffsets();
+  const std::vector<size_t> &column_indices = matrix.GetColumnIndices();
+  const std::vector<TElement> &matrix_values = matrix.GetValues();
+
+  // L is computed into local buffers, so that a failure leaves the
+  // previous factorization intact
+  std::vector<size_t> row_indices(column_offsets.back());
+  std::vector<TElement> values(column_offsets.back());
+
+  // up-looking factorization: row k of L is computed by a sparse
+  // triangular solve with the already computed rows
+  std::vector<TElement> x(n, 0);
+  std::vector<size_t> next(column_offsets.begin(), column_offsets.end() - 1);
+  std::vector<size_t> stack(n);
+  std::vector<size_t> marker(n, n);
+  for (size_t k = 0; k < n; ++k)
+  {
+    const size_t top = SparseCholeskyRowPattern(matrix, permutation, inverse_permutation, this->analysis.parent, k, stack, marker);
+
+    const size_t row = permutation[k];
+    for (size_t i = row_offsets[row]; i < row_offsets[row + 1]; ++i)
+    {
+      const size_t column = inverse_permutation[column_indices[i]];
+      if (column <= k)
+      {
+        x[column] += matrix_values[i];
+      }
+    }
+
+    TElement diagonal = x[k];
+    x[k] = 0;
+    for (size_t t = top; t < n; ++t)
+    {
+      const size_t column = stack[t];
+      const TElement value = x[column] / values[column_offsets[column]];
+      x[column] = 0;
+      for (size_t i = column_offsets[column] + 1; i < next[column]; ++i)
+      {
+        x[row_indices[i]] -= values[i] * value;
+      }
+      diagonal -= value * value;
+      if (next[column] == column_offsets[column + 1])
+      {
+        throw std::logic_error("Matrix pattern does not match symbolic analysis!");
+      }
+      const size_t position = next[column]++;
+      row_indices[position] = k;
+      values[position] = value;
+    }
+
+    if (diagonal <= 0)
+    {
+      throw std::logic_error("Matrix not positive definite!");
+    }
+
+    const size_t position = next[k]++;
+    row_indices[position] = k;
+    values[position] = std::sqrt(diagonal);
+  }
+
+  // fewer entries than analyzed would leave undefined values in L
+  for (size_t k = 0; k < n; ++k)
+  {
+    if (next[k] != column_offsets[k + 1])
+    {
+      throw std::logic_error("Matrix pattern does not match symbolic analysis!");
+    }
+  }
+
+  this->row_indices.swap(row_indices);
+  this->values.swap(values);
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition Solve
+//----------------------------------------------------------------------
+template <typename TElement>
+void tSparseCholeskyDecomposition<TElement>::Solve(const TElement *right_side, TElement *solution) const
+{
+  const size_t n = this->analysis.GetDimension();
+  const std::vector<size_t> &permutation = this->analysis.permutation;
+  const std::vector<size_t> &column_offsets = this->analysis.column_offsets;
+
+  std::vector<TElement> temp(n);
+  for (size_t k = 0; k < n; ++k)
+  {
+    temp[k] = right_side[permutation[k]];
+  }
+
+  for (size_t column = 0; column < n; ++column)
+  {
+    temp[column] /= this->values[column_offsets[column]];
+    for (size_t i = column_offsets[column] + 1; i < column_offsets[column + 1]; ++i)
+    {
+      temp[this->row_indices[i]] -= this->values[i] * temp[column];
+    }
+  }
+  for (size_t step = 0; step < n; ++step)
+  {
+    const size_t column = n - step - 1;
+    for (size_t i = column_offsets[column] + 1; i < column_offsets[column + 1]; ++i)
+    {
+      temp[column] -= this->values[i] * temp[this->row_indices[i]];
+    }
+    temp[column] /= this->values[column_offsets[column]];
+  }
+
+  for (size_t k = 0; k < n; ++k)
+  {
+    solution[permutation[k]] = temp[k];
+  }
+}
+
+template <typename TElement>
+const std::vector<TElement> tSparseCholeskyDecomposition<TElement>::Solve(const std::vector<TElement> &right_side) const
+{
+  if (right_side.size() != this->analysis.GetDimension())
+  {
+    throw std::logic_error("Dimension of right-hand side does not match matrix!");
+  }
+  std::vector<TElement> solution(right_side.size());
+  this->Solve(right_side.data(), solution.data());
+  return solution;
+}
+
+//----------------------------------------------------------------------
+// tSparseCholeskyDecomposition LogDeterminant
+//----------------------------------------------------------------------
+template <typename TElement>
+const TElement tSparseCholeskyDecomposition<TElement>::LogDeterminant() const
+{
+  const std::vector<size_t> &column_offsets = this->analysis.column_offsets;
+  TElement sum = 0;
+  for (size_t column = 0; column + 1 < column_offsets.size(); ++column)
+  {
+    sum += std::log(this->values[column_offsets[column]]);
+  }
+  return 2 * sum;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,231 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSparseMatrix.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSparseMatrix
+ *
+ * \b tSparseMatrix
+ *
+ * A matrix whose dimensions are determined at runtime and of which only
+ * the non-zero elements are stored, in compressed sparse row (CSR)
+ * format. That is the natural representation of the large, very sparse
+ * information matrices that arise from pose graphs or landmark maps.
+ *
+ * The CSR representation of the transposed matrix is the compressed
+ * sparse column (CSC) representation of the original one, so
+ * Transposed() also serves as conversion between both formats.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tSparseMatrix_h__
+#define __rrlib__math__tSparseMatrix_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A sparse matrix in compressed sparse row format
+/*!
+ * The column indices of row r are stored in ascending order at
+ * positions GetRowOffsets()[r] to GetRowOffsets()[r + 1] - 1 of
+ * GetColumnIndices(), the corresponding values at the same positions of
+ * GetValues().
+ */
+template <typename TElement = double>
+class tSparseMatrix
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  /*! A single element given in coordinate format */
+  struct tEntry
+  {
+    size_t row;
+    size_t column;
+    TElement value;
+  };
+
+  /*! Ctor of an empty matrix with the given dimensions
+   *
+   * \param rows      The number of rows
+   * \param columns   The number of columns
+   */
+  tSparseMatrix(size_t rows = 0, size_t columns = 0);
+
+  /*! Ctor from elements in coordinate format
+   *
+   * The entries may be given in any order. Values of entries with the
+   * same position are summed up, as is usual when assembling e.g. the
+   * information matrix of a least squares problem.
+   *
+   * \param rows      The number of rows
+   * \param columns   The number of columns
+   * \param entries   The non-zero elements
+   *
+   * \exception std::logic_error if an entry lies outside the matrix
+   */
+  tSparseMatrix(size_t rows, size_t columns, const std::vector<tEntry> &entries);
+
+  /*! Ctor from raw CSR arrays
+   *
+   * \param rows             The number of rows
+   * \param columns          The number of columns
+   * \param row_offsets      The rows + 1 offsets of the rows into \a column_indices and \a values
+   * \param column_indices   The column indices of the elements, ascending within each row
+   * \param values           The values of the elements
+   *
+   * \exception std::logic_error if the arrays do not describe a valid matrix
+   */
+  tSparseMatrix(size_t rows, size_t columns, const std::vector<size_t> &row_offsets, const std::vector<size_t> &column_indices, const std::vector<TElement> &values);
+
+  inline size_t GetNumberOfRows() const
+  {
+    return this->number_of_rows;
+  }
+
+  inline size_t GetNumberOfColumns() const
+  {
+    return this->number_of_columns;
+  }
+
+  inline size_t GetNumberOfNonZeros() const
+  {
+    return this->values.size();
+  }
+
+  inline const std::vector<size_t> &GetRowOffsets() const
+  {
+    return this->row_offsets;
+  }
+
+  inline const std::vector<size_t> &GetColumnIndices() const
+  {
+    return this->column_indices;
+  }
+
+  inline const std::vector<TElement> &GetValues() const
+  {
+    return this->values;
+  }
+
+  inline std::vector<TElement> &GetValues()
+  {
+    return this->values;
+  }
+
+  /*! Element access
+   *
+   * Runs in O(log k) for a row with k stored elements
+   *
+   * \param row      The row of the element
+   * \param column   The column of the element
+   *
+   * \return The value of the element, which is zero if it is not stored
+   */
+  const TElement operator()(size_t row, size_t column) const;
+
+  /*! Compute y = A * x
+   *
+   * \param x   The GetNumberOfColumns() elements of the vector to multiply
+   * \param y   The GetNumberOfRows() elements of the result
+   */
+  void Multiply(const TElement *x, TElement *y) const;
+
+  /*! Compute y = A' * x
+   *
+   * \param x   The GetNumberOfRows() elements of the vector to multiply
+   * \param y   The GetNumberOfColumns() elements of the result
+   */
+  void MultiplyTransposed(const TElement *x, TElement *y) const;
+
+  /*! The transposed matrix
+   *
+   * Also converts between CSR and CSC, as the CSR arrays of the result
+   * are the CSC arrays of this matrix.
+   *
+   * \return The transposed matrix
+   */
+  const tSparseMatrix Transposed() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  size_t number_of_rows;
+  size_t number_of_columns;
+  std::vector<size_t> row_offsets;
+  std::vector<size_t> column_indices;
+  std::vector<TElement> values;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tSparseMatrix<float>;
+extern template class tSparseMatrix<double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tSparseMatrix.hpp"
+
+#endif
@@ -0,0 +1,249 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tSparseMatrix.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tSparseMatrix constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+tSparseMatrix<TElement>::tSparseMatrix(size_t rows, size_t columns)
+  : number_of_rows(rows),
+    number_of_columns(columns),
+    row_offsets(rows + 1, 0)
+{}
+
+template <typename TElement>
+tSparseMatrix<TElement>::tSparseMatrix(size_t rows, size_t columns, const std::vector<tEntry> &entries)
+  : number_of_rows(rows),
+    number_of_columns(columns),
+    row_offsets(rows + 1, 0)
+{
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->row >= rows || it->column >= columns)
+    {
+      throw std::logic_error("Sparse matrix entry out of bounds!");
+    }
+    this->row_offsets[it->row + 1]++;
+  }
+  for (size_t row = 0; row < rows; ++row)
+  {
+    this->row_offsets[row + 1] += this->row_offsets[row];
+  }
+
+  // bucket the entries by row, then sort and merge within each row
+  std::vector<std::pair<size_t, TElement>> sorted(entries.size());
+  std::vector<size_t> next(this->row_offsets.begin(), this->row_offsets.end() - 1);
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    sorted[next[it->row]++] = std::make_pair(it->column, it->value);
+  }
+
+  this->column_indices.reserve(entries.size());
+  this->values.reserve(entries.size());
+  size_t begin = 0;
+  for (size_t row = 0; row < rows; ++row)
+  {
+    const size_t end = this->row_offsets[row + 1];
+    std::sort(sorted.begin() + begin, sorted.begin() + end, [](const std::pair<size_t, TElement> &left, const std::pair<size_t, TElement> &right)
+    {
+      return left.first < right.first;
+    });
+    this->row_offsets[row] = this->column_indices.size();
+    for (size_t i = begin; i < end; ++i)
+    {
+      if (i > begin && sorted[i].first == this->column_indices.back())
+      {
+        this->values.back() += sorted[i].second;
+        continue;
+      }
+      this->column_indices.push_back(sorted[i].first);
+      this->values.push_back(sorted[i].second);
+    }
+    begin = end;
+  }
+  this->row_offsets[rows] = this->column_indices.size();
+}
+
+template <typename TElement>
+tSparseMatrix<TElement>::tSparseMatrix(size_t rows, size_t columns, const std::vector<size_t> &row_offsets, const std::vector<size_t> &column_indices, const std::vector<TElement> &values)
+  : number_of_rows(rows),
+    number_of_columns(columns),
+    row_offsets(row_offsets),
+    column_indices(column_indices),
+    values(values)
+{
+  if (this->row_offsets.size() != rows + 1 || this->row_offsets.front() != 0 || this->row_offsets.back() != this->column_indices.size() || this->column_indices.size() != this->values.size())
+  {
+    throw std::logic_error("Inconsistent sparse matrix data!");
+  }
+  for (size_t row = 0; row < rows; ++row)
+  {
+    if (this->row_offsets[row] > this->row_offsets[row + 1] || this->row_offsets[row + 1] > this->column_indices.size())
+    {
+      throw std::logic_error("Inconsistent sparse matrix data!");
+    }
+    for (size_t i = this->row_offsets[row]; i < this->row_offsets[row + 1]; ++i)
+    {
+      if (this->column_indices[i] >= columns || (i > this->row_offsets[row] && this->column_indices[i] <= this->column_indices[i - 1]))
+      {
+        throw std::logic_error("Inconsistent sparse matrix data!");
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tSparseMatrix operator()
+//----------------------------------------------------------------------
+template <typename TElement>
+const TElement tSparseMatrix<TElement>::operator()(size_t row, size_t column) const
+{
+  assert(row < this->number_of_rows && column < this->number_of_columns);
+  auto begin = this->column_indices.begin() + this->row_offsets[row];
+  auto end = this->column_indices.begin() + this->row_offsets[row + 1];
+  auto it = std::lower_bound(begin, end, column);
+  if (it == end || *it != column)
+  {
+    return 0;
+  }
+  return this->values[it - this->column_indices.begin()];
+}
+
+//----------------------------------------------------------------------
+// tSparseMatrix Multiply
+//----------------------------------------------------------------------
+template <typename TElement>
+void tSparseMatrix<TElement>::Multiply(const TElement *x, TElement *y) const
+{
+  for (size_t row = 0; row < this->number_of_rows; ++row)
+  {
+    TElement sum = 0;
+    for (size_t i = this->row_offsets[row]; i < this->row_offsets[row + 1]; ++i)
+    {
+      sum += this->values[i] * x[this->column_indices[i]];
+    }
+    y[row] = sum;
+  }
+}
+
+//----------------------------------------------------------------------
+// tSparseMatrix MultiplyTransposed
+//----------------------------------------------------------------------
+template <typename TElement>
+void tSparseMatrix<TElement>::MultiplyTransposed(const TElement *x, TElement *y) const
+{
+  std::fill(y, y + this->number_of_columns, TElement(0));
+  for (size_t row = 0; row < this->number_of_rows; ++row)
+  {
+    for (size_t i = this->row_offsets[row]; i < this->row_offsets[row + 1]; ++i)
+    {
+      y[this->column_indices[i]] += this->values[i] * x[row];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tSparseMatrix Transposed
+//----------------------------------------------------------------------
+template <typename TElement>
+const tSparseMatrix<TElement> tSparseMatrix<TElement>::Transposed() const
+{
+  std::vector<size_t> offsets(this->number_of_columns + 1, 0);
+  for (auto it = this->column_indices.begin(); it != this->column_indices.end(); ++it)
+  {
+    offsets[*it + 1]++;
+  }
+  for (size_t column = 0; column < this->number_of_columns; ++column)
+  {
+    offsets[column + 1] += offsets[column];
+  }
+
+  // rows are visited in ascending order, so the new rows stay sorted
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  std::vector<size_t> indices(this->values.size());
+  std::vector<TElement> transposed_values(this->values.size());
+  for (size_t row = 0; row < this->number_of_rows; ++row)
+  {
+    for (size_t i = this->row_offsets[row]; i < this->row_offsets[row + 1]; ++i)
+    {
+      const size_t position = next[this->column_indices[i]]++;
+      indices[position] = row;
+      transposed_values[position] = this->values[i];
+    }
+  }
+
+  tSparseMatrix result(this->number_of_columns, this->number_of_rows);
+  result.row_offsets.swap(offsets);
+  result.column_indices.swap(indices);
+  result.values.swap(transposed_values);
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
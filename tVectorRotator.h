@@ -0,0 +1,200 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tVectorRotator.h
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tVectorRotator
+ *
+ * \b tVectorRotator
+ *
+ * Rotating many vectors by the same rotation with
+ * tVector<3>::Rotate(angle, axis) evaluates the trigonometric functions
+ * and normalizes the axis for every vector. tVectorRotator does this
+ * once and stores the rotation matrix, so that each vector afterwards
+ * costs 9 multiplications and 6 additions.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__math__tVectorRotator_h__
+#define __rrlib__math__tVectorRotator_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/math/tAngle.h"
+#include "rrlib/math/tSinCos.h"
+#include "rrlib/math/tVector.h"
+#include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tQuaternion.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A precomputed rotation for rotating many 3D vectors
+/*!
+ * Stores the rotation matrix of a rotation given as axis and angle,
+ * matrix or quaternion and applies it to single vectors, iterator ranges
+ * and coordinates in structure-of-arrays layout.
+ */
+template <typename TElement = double>
+class tVectorRotator
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef math::tVector<3, TElement, vector::Cartesian> tVector;
+
+  /*! Ctor from axis and angle
+   *
+   * Same rotation as tVector<3>::Rotate(angle, axis)
+   *
+   * \param angle   The rotation angle
+   * \param axis    The rotation axis, which does not need to be normalized
+   */
+  template <typename TAxisElement>
+  tVectorRotator(tAngleRad angle, const math::tVector<3, TAxisElement, vector::Cartesian> &axis);
+
+  /*! Ctor from axis and angle with precomputed sine and cosine
+   *
+   * \param angle   The rotation angle
+   * \param axis    The rotation axis, which does not need to be normalized
+   */
+  template <typename TSinCosElement, typename TAxisElement>
+  tVectorRotator(const tSinCos<TSinCosElement> &angle, const math::tVector<3, TAxisElement, vector::Cartesian> &axis);
+
+  /*! Ctor from a rotation matrix
+   *
+   * \param matrix   The rotation matrix
+   */
+  explicit tVectorRotator(const tMatrix<3, 3, TElement> &matrix);
+
+  /*! Ctor from a quaternion
+   *
+   * \param quaternion   The unit quaternion
+   */
+  explicit tVectorRotator(const tQuaternion<TElement> &quaternion);
+
+  inline const tMatrix<3, 3, TElement> &GetMatrix() const
+  {
+    return this->matrix;
+  }
+
+  /*! Rotate a vector in place
+   *
+   * \param vector   The vector to rotate
+   */
+  inline void Rotate(tVector &vector) const __attribute__((always_inline));
+
+  inline const tVector Rotated(const tVector &vector) const __attribute__((always_inline));
+
+  /*! Rotate all vectors of an iterator range in place
+   *
+   * \param begin   Begin of the range of tVector<3>
+   * \param end     End of the range of tVector<3>
+   */
+  template <typename TIterator>
+  void Rotate(TIterator begin, TIterator end) const;
+
+  /*! Rotate all vectors of an iterator range into another range
+   *
+   * \param begin    Begin of the range of tVector<3>
+   * \param end      End of the range of tVector<3>
+   * \param result   Begin of the output range
+   *
+   * \return The end of the output range
+   */
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator Rotate(TInputIterator begin, TInputIterator end, TOutputIterator result) const;
+
+  /*! Rotate coordinates in structure-of-arrays layout
+   *
+   * The loop has no dependencies between iterations and compiles to
+   * SIMD code. The outputs may be the same arrays as the inputs.
+   *
+   * \param x          The x coordinates
+   * \param y          The y coordinates
+   * \param z          The z coordinates
+   * \param result_x   The rotated x coordinates
+   * \param result_y   The rotated y coordinates
+   * \param result_z   The rotated z coordinates
+   * \param count      The number of vectors
+   */
+  void Rotate(const TElement *x, const TElement *y, const TElement *z, TElement *result_x, TElement *result_y, TElement *result_z, size_t count) const;
+
+  /*! Rotate coordinates in structure-of-arrays layout in place */
+  inline void Rotate(TElement *x, TElement *y, TElement *z, size_t count) const
+  {
+    this->Rotate(x, y, z, x, y, z, count);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tMatrix<3, 3, TElement> matrix;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tVectorRotator<float>;
+extern template class tVectorRotator<double>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#include "rrlib/math/tVectorRotator.hpp"
+
+#endif
@@ -0,0 +1,167 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/tVectorRotator.hpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tVectorRotator constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+template <typename TAxisElement>
+tVectorRotator<TElement>::tVectorRotator(tAngleRad angle, const math::tVector<3, TAxisElement, vector::Cartesian> &axis)
+  : tVectorRotator(tSinCos<double>(angle), axis)
+{}
+
+template <typename TElement>
+template <typename TSinCosElement, typename TAxisElement>
+tVectorRotator<TElement>::tVectorRotator(const tSinCos<TSinCosElement> &angle, const math::tVector<3, TAxisElement, vector::Cartesian> &axis)
+{
+  if (axis.Length() == 0)
+  {
+    throw std::logic_error("Invalid rotation axis (with zero length)");
+  }
+  math::tVector<3, TAxisElement, vector::Cartesian> normalized_axis(axis.Normalized());
+  double sine, cosine;
+  angle.SinCos(sine, cosine);
+  const double one_minus_cosine = 1 - cosine;
+  const double x = normalized_axis.X();
+  const double y = normalized_axis.Y();
+  const double z = normalized_axis.Z();
+  this->matrix = tMatrix<3, 3, TElement>(cosine + x * x * one_minus_cosine, x * y * one_minus_cosine - z * sine, x * z * one_minus_cosine + y * sine,
+                                         x * y * one_minus_cosine + z * sine, cosine + y * y * one_minus_cosine, y * z * one_minus_cosine - x * sine,
+                                         x * z * one_minus_cosine - y * sine, y * z * one_minus_cosine + x * sine, cosine + z * z * one_minus_cosine);
+}
+
+template <typename TElement>
+tVectorRotator<TElement>::tVectorRotator(const tMatrix<3, 3, TElement> &matrix)
+  : matrix(matrix)
+{}
+
+template <typename TElement>
+tVectorRotator<TElement>::tVectorRotator(const tQuaternion<TElement> &quaternion)
+  : matrix(quaternion.GetRotationMatrix())
+{}
+
+//----------------------------------------------------------------------
+// tVectorRotator Rotate
+//----------------------------------------------------------------------
+template <typename TElement>
+void tVectorRotator<TElement>::Rotate(tVector &vector) const
+{
+  vector = this->Rotated(vector);
+}
+
+template <typename TElement>
+const typename tVectorRotator<TElement>::tVector tVectorRotator<TElement>::Rotated(const tVector &vector) const
+{
+  const TElement *m = reinterpret_cast<const TElement *>(&this->matrix);
+  return tVector(m[0] * vector[0] + m[1] * vector[1] + m[2] * vector[2],
+                 m[3] * vector[0] + m[4] * vector[1] + m[5] * vector[2],
+                 m[6] * vector[0] + m[7] * vector[1] + m[8] * vector[2]);
+}
+
+template <typename TElement>
+template <typename TIterator>
+void tVectorRotator<TElement>::Rotate(TIterator begin, TIterator end) const
+{
+  for (TIterator it = begin; it != end; ++it)
+  {
+    this->Rotate(*it);
+  }
+}
+
+template <typename TElement>
+template <typename TInputIterator, typename TOutputIterator>
+TOutputIterator tVectorRotator<TElement>::Rotate(TInputIterator begin, TInputIterator end, TOutputIterator result) const
+{
+  for (TInputIterator it = begin; it != end; ++it, ++result)
+  {
+    *result = this->Rotated(*it);
+  }
+  return result;
+}
+
+template <typename TElement>
+void tVectorRotator<TElement>::Rotate(const TElement *x, const TElement *y, const TElement *z, TElement *result_x, TElement *result_y, TElement *result_z, size_t count) const
+{
+  // copies in registers let the compiler vectorize without reloading
+  // the matrix after each store through the output pointers
+  const TElement *m = reinterpret_cast<const TElement *>(&this->matrix);
+  const TElement m0 = m[0], m1 = m[1], m2 = m[2];
+  const TElement m3 = m[3], m4 = m[4], m5 = m[5];
+  const TElement m6 = m[6], m7 = m[7], m8 = m[8];
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TElement vx = x[i];
+    const TElement vy = y[i];
+    const TElement vz = z[i];
+    result_x[i] = m0 * vx + m1 * vy + m2 * vz;
+    result_y[i] = m3 * vx + m4 * vy + m5 * vz;
+    result_z[i] = m6 * vx + m7 * vy + m8 * vz;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -35,8 +35,16 @@
 #include "rrlib/util/tUnitTestSuite.h"
 
 #include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+#include <sstream>
+#include <limits>
 
 #include "rrlib/math/tAngle.h"
+#include "rrlib/math/tSinCos.h"
+#include "rrlib/math/tCircularStatistics.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -80,6 +88,14 @@ class TestAngles : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(ArithmeticOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
   RRLIB_UNIT_TESTS_ADD_TEST(TestFunctions);
+  RRLIB_UNIT_TESTS_ADD_TEST(TrigonometryPolicies);
+  RRLIB_UNIT_TESTS_ADD_TEST(InverseTrigonometryPolicies);
+  RRLIB_UNIT_TESTS_ADD_TEST(Wrapping);
+  RRLIB_UNIT_TESTS_ADD_TEST(BinaryAngles);
+  RRLIB_UNIT_TESTS_ADD_TEST(SinCos);
+  RRLIB_UNIT_TESTS_ADD_TEST(BatchFunctions);
+  RRLIB_UNIT_TESTS_ADD_TEST(CircularStatistics);
+  RRLIB_UNIT_TESTS_ADD_TEST(InterpolationAndUnwrapping);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -154,6 +170,13 @@ private:
     RRLIB_UNIT_TESTS_ASSERT(std::memcmp(&converted_rad_no_wrap, &rad_no_wrap, sizeof(double)) == 0);
     RRLIB_UNIT_TESTS_ASSERT(std::memcmp(&converted_rad_signed, &rad_signed, sizeof(double)) == 0);
     RRLIB_UNIT_TESTS_ASSERT(std::memcmp(&converted_rad_unsigned, &rad_unsigned, sizeof(double)) == 0);
+
+    RRLIB_UNIT_TESTS_ASSERT((std::is_trivially_copyable<tAngle<double, angle::Radian, angle::Signed>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_trivially_copyable<tAngle<float, angle::Degree, angle::Unsigned>>::value));
+
+    tAngle<float, angle::Radian, angle::Signed> float_rad_signed(rad_no_wrap);
+    tAngle<double, angle::Radian, angle::Signed> widened_rad_signed(float_rad_signed);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<double>(float_rad_signed.Value()), widened_rad_signed.Value());
   }
 
   void ComparisonOperators()
@@ -215,6 +238,10 @@ private:
     rad_no_wrap += tAngle<float, angle::Degree, angle::NoWrap>(90);
     RRLIB_UNIT_TESTS_EQUALITY(5 * M_PI_2, rad_no_wrap.Value());
 
+    RRLIB_UNIT_TESTS_EQUALITY(-5 * M_PI_2, (-rad_no_wrap).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(-M_PI, (-tAngle<double, angle::Radian, angle::Signed>(-M_PI)).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(270.0, (-tAngle<double, angle::Degree, angle::Unsigned>(90)).Value());
+
     rad_no_wrap -= tAngle<double, angle::Degree, angle::NoWrap>(90);
     RRLIB_UNIT_TESTS_EQUALITY(2 * M_PI, rad_no_wrap.Value());
 
@@ -449,6 +476,463 @@ private:
 
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("10 deg must not be between 190 deg and 200 deg", false, IsAngleInbetween(tAngleDegUnsigned(10), tAngleDegUnsigned(190), tAngleDegUnsigned(200)));
   }
+
+  template <typename TTrigonometryPolicy, typename TElement>
+  static TElement MaximumTrigonometryError()
+  {
+    TElement error = 0;
+    for (int i = -5000; i <= 5000; ++i)
+    {
+      tAngle<TElement, angle::Radian, angle::NoWrap> angle(i * 0.0031);
+      TElement sine, cosine;
+      angle.template SinCos<TTrigonometryPolicy>(sine, cosine);
+      error = std::max(error, std::fabs(sine - std::sin(angle.Value())));
+      error = std::max(error, std::fabs(cosine - std::cos(angle.Value())));
+      error = std::max(error, std::fabs(angle.template Sine<TTrigonometryPolicy>() - sine));
+      error = std::max(error, std::fabs(angle.template Cosine<TTrigonometryPolicy>() - cosine));
+    }
+    return error;
+  }
+
+  void TrigonometryPolicies()
+  {
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Exact, double>() == 0));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Polynomial<4>, double>() < 1E-5));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Polynomial<7>, double>() < 3E-8));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Polynomial<16>, double>() < 1E-15));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Table<256>, double>() < 8E-5));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Table<>, double>() < 3E-7));
+
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Polynomial<4>, float>() < 2E-5));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Polynomial<7>, float>() < 1E-6));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumTrigonometryError<angle::Table<>, float>() < 1E-6));
+
+    double sine, cosine;
+    tAngleDeg(30).SinCos<angle::Polynomial<7>>(sine, cosine);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(0.5, sine, 1E-7));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(std::sqrt(3.0) / 2, cosine, 1E-7));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(-1.0, tAngleDeg(-90).Sine<angle::Table<>>(), 1E-7));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(-1.0, tAngleRadUnsigned(M_PI).Cosine<angle::Polynomial<4>>(), 1E-5));
+  }
+
+  template <typename TTrigonometryPolicy, typename TElement>
+  static TElement MaximumInverseTrigonometryError()
+  {
+    TElement error = 0;
+    for (int i = -1000; i <= 1000; ++i)
+    {
+      TElement value = i / TElement(1000);
+      error = std::max(error, std::fabs(ASin<TTrigonometryPolicy>(value).Value() - std::asin(value)));
+      error = std::max(error, std::fabs(ACos<TTrigonometryPolicy>(value).Value() - std::acos(value)));
+      error = std::max(error, std::fabs(ATan<TTrigonometryPolicy>(value * 50).Value() - std::atan(value * 50)));
+    }
+    for (int i = -50; i <= 50; ++i)
+    {
+      for (int k = -50; k <= 50; ++k)
+      {
+        TElement y = i * TElement(0.37), x = k * TElement(0.21);
+        error = std::max(error, std::fabs(ATan2<TTrigonometryPolicy>(y, x).Value() - std::atan2(y, x)));
+      }
+    }
+    return error;
+  }
+
+  template <typename TTrigonometryPolicy>
+  void CheckSpecialInverseTrigonometryValues()
+  {
+    const double cNAN = std::numeric_limits<double>::quiet_NaN();
+    const double cINFINITY = std::numeric_limits<double>::infinity();
+    const double values[][2] = { { cNAN, 1.0 }, { 1.0, cNAN }, { cNAN, cNAN }, { 0.0, 0.0 }, { 0.0, -0.0 }, { -0.0, 0.0 }, { -0.0, -0.0 }, { 0.0, -1.0 }, { -0.0, -1.0 },
+      { cINFINITY, cINFINITY }, { cINFINITY, -cINFINITY }, { -cINFINITY, -cINFINITY }, { 1.0, cINFINITY }, { 1.0, -cINFINITY }, { -1.0, -cINFINITY }
+    };
+    for (auto & value : values)
+    {
+      double expected = std::atan2(value[0], value[1]);
+      double result = TTrigonometryPolicy::ATan2(value[0], value[1]);
+      if (std::isnan(expected))
+      {
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE("NaN propagates", std::isnan(result));
+      }
+      else
+      {
+        RRLIB_UNIT_TESTS_ASSERT(std::fabs(expected - result) < 1E-7);
+        RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Sign of zero selects the half-plane", std::signbit(expected), std::signbit(result));
+      }
+    }
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(TTrigonometryPolicy::ASin(cNAN)));
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(TTrigonometryPolicy::ACos(cNAN)));
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(TTrigonometryPolicy::ATan(cNAN)));
+  }
+
+  void InverseTrigonometryPolicies()
+  {
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Exact, double>() == 0));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Polynomial<4>, double>() < 1E-5));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Polynomial<7>, double>() < 3E-8));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Polynomial<16>, double>() < 1E-15));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Table<>, double>() < 3E-8));
+    RRLIB_UNIT_TESTS_ASSERT((MaximumInverseTrigonometryError<angle::Polynomial<7>, float>() < 1E-6));
+
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, ATan2<angle::Polynomial<7>>(0.0, 0.0).Value());
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(M_PI - ATan2<angle::Polynomial<7>>(0.0, -1.0).Value()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(-M_PI / 2 - ATan2<angle::Polynomial<7>>(-2.0, 0.0).Value()) < 1E-12);
+    CheckSpecialInverseTrigonometryValues<angle::Polynomial<4>>();
+    CheckSpecialInverseTrigonometryValues<angle::Polynomial<7>>();
+    CheckSpecialInverseTrigonometryValues<angle::Polynomial<16>>();
+    CheckSpecialInverseTrigonometryValues<angle::Table<>>();
+
+    const size_t cCOUNT = 100;
+    double y[cCOUNT], x[cCOUNT], radians[cCOUNT];
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      y[i] = std::sin(i * 0.1) * (i + 1);
+      x[i] = std::cos(i * 0.1) * (i + 1);
+    }
+    ATan2<angle::Polynomial<7>>(y, x, radians, cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::atan2(y[i], x[i]) - radians[i]) < 3E-8);
+    }
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      x[i] = i / 50.0 - 1;
+    }
+    ASin<angle::Polynomial<4>>(x, radians, cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(std::asin(x[i]), radians[i], 1E-5));
+    }
+    ACos(x, radians, cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(std::acos(x[i]), radians[i]);
+    }
+    ATan<angle::Polynomial<16>>(x, y, cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::atan(x[i]) - y[i]) < 1E-15);
+    }
+  }
+
+  void Wrapping()
+  {
+    for (int i = -2000; i <= 2000; ++i)
+    {
+      double value = i * 0.0123;
+      double signed_reference = std::fmod(value + M_PI, 2 * M_PI);
+      signed_reference = (signed_reference < 0 ? signed_reference + 2 * M_PI : signed_reference) - M_PI;
+      double unsigned_reference = std::fmod(value, 2 * M_PI);
+      unsigned_reference = unsigned_reference < 0 ? unsigned_reference + 2 * M_PI : unsigned_reference;
+
+      tAngleRadSigned angle_signed(value);
+      tAngleRadUnsigned angle_unsigned(value);
+      RRLIB_UNIT_TESTS_ASSERT(angle_signed.Value() >= -M_PI && angle_signed.Value() < M_PI);
+      RRLIB_UNIT_TESTS_ASSERT(angle_unsigned.Value() >= 0 && angle_unsigned.Value() < 2 * M_PI);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::remainder(angle_signed.Value() - signed_reference, 2 * M_PI)) < 1E-12);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::remainder(angle_unsigned.Value() - unsigned_reference, 2 * M_PI)) < 1E-12);
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY(-M_PI, tAngleRadSigned(M_PI).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, tAngleRadUnsigned(-1E-20).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(-180.0, tAngleDegSigned(540).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(90.0, tAngleDegUnsigned(-630).Value());
+  }
+
+  void BinaryAngles()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(1) << 30, tAngleBinary(tAngleDeg(90)).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(3) << 30, tAngleBinary(tAngleDeg(-90)).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(1) << 31, tAngleBinary(tAngleRad(-M_PI)).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(1) << 30, tAngleBinary(tAngle<double, angle::Degree, angle::NoWrap>(810)).Value());
+
+    tAngleBinary heading(tAngleDeg(170));
+    heading += tAngleBinary(tAngleDeg(20));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(-170.0, tAngleDeg(heading).Value(), 1E-6));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(190.0, tAngleDegUnsigned(heading).Value(), 1E-6));
+    heading -= tAngleBinary(tAngleDeg(200));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(-10.0, tAngleDeg(heading).Value(), 1E-6));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(10.0, tAngleDeg(-heading).Value(), 1E-6));
+
+    tAngleBinary accumulated;
+    tAngleBinary step(std::uint32_t(1) << 24);
+    for (int i = 0; i < 256 * 10; ++i)
+    {
+      accumulated += step;
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(0), accumulated.Value());
+
+    RRLIB_UNIT_TESTS_ASSERT(tAngleBinary(tAngleDeg(10)) < tAngleBinary(tAngleDeg(20)));
+    RRLIB_UNIT_TESTS_ASSERT((tAngleBinary(tAngleDeg(30)) < tAngle<double, angle::Degree, angle::NoWrap>(40)));
+
+    double sine, cosine;
+    tAngleBinary(tAngleDeg(30)).SinCos(sine, cosine);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(sine - 0.5) < 3E-7);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(cosine - std::sqrt(3.0) / 2) < 3E-7);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(tAngleBinary(tAngleDeg(-45)).Sine() + std::sqrt(0.5)) < 3E-7);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(tAngleBinary(tAngleDeg(-45)).Sine<angle::Exact>() + std::sqrt(0.5)) < 1E-9);
+
+    std::stringstream stream;
+    stream << tAngleBinary(std::uint32_t(12345));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("12345bam"), stream.str());
+    tAngleBinary read;
+    stream >> read;
+    RRLIB_UNIT_TESTS_EQUALITY(std::uint32_t(12345), read.Value());
+  }
+
+  void SinCos()
+  {
+    tSinCos<> zero;
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, zero.Angle().Value());
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, zero.Sine());
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, zero.Cosine());
+
+    tSinCos<> a(tAngleDeg(150));
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(a.Angle().Value() - 5 * M_PI / 6) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(a.Sine() - 0.5) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(a.Cosine() + std::sqrt(0.75)) < 1E-12);
+
+    tSinCos<> b(tAngleRad(1.1), angle::Polynomial<7>());
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(b.Sine() - std::sin(1.1)) < 3E-8);
+
+    for (double first = -3.1; first < 3.2; first += 0.9)
+    {
+      for (double second = -3.1; second < 3.2; second += 0.8)
+      {
+        tSinCos<> left((tAngleRad(first))), right((tAngleRad(second)));
+        tAngleRad sum = tAngleRad(first) + tAngleRad(second);
+        tAngleRad difference = tAngleRad(first) - tAngleRad(second);
+        RRLIB_UNIT_TESTS_ASSERT(std::fabs((left + right).Sine() - sum.Sine()) < 1E-12);
+        RRLIB_UNIT_TESTS_ASSERT(std::fabs((left + right).Cosine() - sum.Cosine()) < 1E-12);
+        RRLIB_UNIT_TESTS_EQUALITY(sum.Value(), (left + right).Angle().Value());
+        RRLIB_UNIT_TESTS_ASSERT(std::fabs((left - right).Sine() - difference.Sine()) < 1E-12);
+        RRLIB_UNIT_TESTS_ASSERT(std::fabs((left - right).Cosine() - difference.Cosine()) < 1E-12);
+      }
+      tSinCos<> angle((tAngleRad(first)));
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(angle.Halved().Sine() - std::sin(angle.Angle().Value() / 2)) < 1E-15);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(angle.Halved().Cosine() - std::cos(angle.Angle().Value() / 2)) < 1E-15);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs((-angle).Sine() + std::sin(first)) < 1E-15);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(tSinCos<>(tAngleRad(-M_PI)).Halved().Sine() + 1) < 1E-12);
+
+    tSinCos<> direction(3.0, 4.0);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(direction.Sine() - 0.6) < 1E-15);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(direction.Cosine() - 0.8) < 1E-15);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(direction.Angle().Value() - std::atan2(3.0, 4.0)) < 1E-15);
+    RRLIB_UNIT_TESTS_EXCEPTION(tSinCos<>(0.0, 0.0), std::logic_error);
+  }
+
+  void BatchFunctions()
+  {
+    const size_t count = 40;
+    double raw[count];
+    tAngle<double, angle::Radian, angle::NoWrap> angles[count];
+    tAngle<double, angle::Radian, angle::NoWrap> others[count];
+    for (size_t i = 0; i < count; ++i)
+    {
+      raw[i] = -20.0 + i * 1.01;
+      angles[i] = tAngle<double, angle::Radian, angle::NoWrap>(raw[i]);
+      others[i] = tAngle<double, angle::Radian, angle::NoWrap>(0.7 * raw[i] - 1);
+    }
+
+    double values[count];
+    std::copy(raw, raw + count, values);
+    WrapSigned(values, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(tAngleRadSigned(raw[i]).Value(), values[i]);
+    }
+    std::copy(raw, raw + count, values);
+    WrapUnsigned<angle::Degree>(values, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(tAngleDegUnsigned(raw[i]).Value(), values[i]);
+    }
+
+    tAngleRadUnsigned wrapped_unsigned[count];
+    WrapUnsigned(angles, wrapped_unsigned, count);
+    tAngleRadSigned wrapped_signed[count];
+    WrapSigned(wrapped_unsigned, wrapped_signed, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(angles[i].WrappedUnsigned().Value(), wrapped_unsigned[i].Value());
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(angles[i].WrappedSigned().Value() - wrapped_signed[i].Value()) < 1E-12);
+    }
+
+    tAngleDegSigned degrees[count];
+    ConvertUnit(angles, degrees, count);
+    ConvertUnit<angle::Degree, angle::Radian>(raw, values, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(tAngleDegSigned(angles[i]).Value() - degrees[i].Value()) < 1E-10);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(raw[i] * 180 / M_PI - values[i]) < 1E-10);
+    }
+
+    double sine[count], cosine[count];
+    math::SinCos(degrees, sine, cosine, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::sin(raw[i]) - sine[i]) < 1E-12);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::cos(raw[i]) - cosine[i]) < 1E-12);
+    }
+    float float_raw[count], float_sine[count], float_cosine[count];
+    std::copy(raw, raw + count, float_raw);
+    math::SinCos<angle::Polynomial<7>>(float_raw, float_sine, float_cosine, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::sin(float_raw[i]) - float_sine[i]) < 1E-6);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::cos(float_raw[i]) - float_cosine[i]) < 1E-6);
+    }
+
+    tAngleRadUnsigned difference[count];
+    tAngleRadSigned shortest_difference[count];
+    Difference(angles, others, difference, count);
+    ShortestDifference(angles, others, shortest_difference, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(GetAngleInbetween(angles[i], others[i]).Value() - difference[i].Value()) < 1E-12);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(tAngleRadSigned(others[i].Value() - angles[i].Value()).Value() - shortest_difference[i].Value()) < 1E-12);
+      RRLIB_UNIT_TESTS_ASSERT(shortest_difference[i].Value() >= -M_PI && shortest_difference[i].Value() < M_PI);
+    }
+
+    tAngleBinary binary_angles[count], binary_others[count];
+    tAngle<std::uint32_t, angle::Binary, angle::Signed> binary_shortest_difference[count];
+    std::uint32_t binary_values[count];
+    for (size_t i = 0; i < count; ++i)
+    {
+      binary_angles[i] = tAngleBinary(angles[i]);
+      binary_others[i] = tAngleBinary(others[i]);
+      binary_values[i] = binary_others[i].Value() - binary_angles[i].Value();
+    }
+    ShortestDifference(binary_angles, binary_others, binary_shortest_difference, count);
+    WrapSigned<angle::Binary>(binary_values, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      std::uint32_t expected = binary_others[i].Value() - binary_angles[i].Value();
+      RRLIB_UNIT_TESTS_EQUALITY(expected, binary_shortest_difference[i].Value());
+      RRLIB_UNIT_TESTS_EQUALITY(expected, binary_values[i]);
+    }
+  }
+
+  void CircularStatistics()
+  {
+    tCircularStatistics<> statistics;
+    RRLIB_UNIT_TESTS_EXCEPTION(statistics.Mean(), std::logic_error);
+    RRLIB_UNIT_TESTS_EXCEPTION(statistics.Variance(), std::logic_error);
+
+    // angles around the seam at +-pi
+    statistics.Add(tAngleDeg(170));
+    statistics.Add(tAngleDeg(-170));
+    statistics.Add(tAngleDeg(180), 2);
+    RRLIB_UNIT_TESTS_EQUALITY(4.0, statistics.TotalWeight());
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(std::fabs(statistics.Mean().Value()) - M_PI) < 1E-12);
+    double expected_length = (2 * std::cos(10 * M_PI / 180) + 2) / 4;
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(statistics.MeanResultantLength() - expected_length) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(statistics.Variance() - (1 - expected_length)) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(statistics.StandardDeviation() - std::sqrt(-2 * std::log(expected_length))) < 1E-12);
+
+    tCircularStatistics<> identical;
+    identical.Add(tSinCos<>(tAngleRad(1)), 3);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(identical.Mean().Value() - 1) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(identical.Variance()) < 1E-12);
+
+    tCircularStatistics<> opposite;
+    opposite.Add(tAngleRad(0));
+    opposite.Add(tAngleRad(M_PI));
+    RRLIB_UNIT_TESTS_ASSERT(opposite.MeanResultantLength() < 1E-12);
+
+    // batch and merged partial results equal the sequential accumulation
+    const size_t count = 150;
+    tAngleRad angles[count];
+    double weights[count];
+    tCircularStatistics<> sequential, first_half, second_half, batch, weighted;
+    for (size_t i = 0; i < count; ++i)
+    {
+      angles[i] = tAngleRad(3.0 + 0.01 * i);
+      weights[i] = 0.5 + (i % 3);
+      sequential.Add(angles[i], weights[i]);
+      (i < count / 2 ? first_half : second_half).Add(angles[i], weights[i]);
+    }
+    batch.Add(angles, count);
+    weighted.Add(angles, weights, count);
+    tCircularStatistics<> merged = first_half + second_half;
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<double>(count), batch.TotalWeight());
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(batch.Mean().Value() - tAngleRad(3.0 + 0.01 * (count - 1) / 2).Value()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(weighted.Mean().Value() - sequential.Mean().Value()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(weighted.Variance() - sequential.Variance()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(merged.Mean().Value() - sequential.Mean().Value()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(merged.TotalWeight() - sequential.TotalWeight()) < 1E-12);
+
+    tCircularStatistics<> approximated;
+    approximated.Add<angle::Polynomial<7>>(angles, count);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(approximated.Mean().Value() - batch.Mean().Value()) < 1E-6);
+
+    merged.Reset();
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, merged.TotalWeight());
+  }
+
+  void InterpolationAndUnwrapping()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(Slerp(tAngleDeg(170), tAngleDeg(-170), 0.25).Value() - 175) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(Slerp(tAngleDeg(170), tAngleDeg(-170), 0.75).Value() + 175) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(Slerp(tAngleDegUnsigned(350), tAngleDegUnsigned(20), 0.5).Value() - 5) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(Slerp(tAngleRad(1), tAngleRad(2), 0.5).Value() - 1.5) < 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY(0xF8000000u, Slerp(tAngleBinary(0xF0000000u), tAngleBinary(0x00000000u), 0.5).Value());
+
+    const size_t count = 5;
+    tAngleDeg first[count] = { tAngleDeg(170), tAngleDeg(-10), tAngleDeg(0), tAngleDeg(-179), tAngleDeg(90) };
+    tAngleDeg second[count] = { tAngleDeg(-170), tAngleDeg(10), tAngleDeg(90), tAngleDeg(179), tAngleDeg(-90) };
+    double factors[count] = { 0.75, 0.5, 1.0 / 3, 0.5, 0.25 };
+    tAngleDeg result[count];
+    Slerp(first, second, factors, result, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(Slerp(first[i], second[i], factors[i]).Value() - result[i].Value()) < 1E-12);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(result[0].Value() + 175) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(result[3].Value() + 180) < 1E-12);
+    Slerp(first, second, 0.5, result, count);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(result[1].Value()) < 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(std::fabs(result[2].Value() - 45) < 1E-12);
+
+    // a heading that turns by 0.3 rad per sample for several full rotations
+    const size_t samples = 100;
+    tAngleRad wrapped[samples];
+    tAngle<double, angle::Radian, angle::NoWrap> unwrapped[samples];
+    for (size_t i = 0; i < samples; ++i)
+    {
+      wrapped[i] = tAngleRad(1 - 0.3 * i);
+    }
+    Unwrap(wrapped, unwrapped, samples);
+    for (size_t i = 0; i < samples; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(unwrapped[i].Value() - (1 - 0.3 * i)) < 1E-10);
+    }
+
+    // unwrapping in chunks gives the same result
+    tAngle<double, angle::Radian, angle::NoWrap> chunked[samples];
+    Unwrap(wrapped, chunked, 30);
+    Unwrap(wrapped + 30, chunked + 30, samples - 30, chunked[29]);
+    for (size_t i = 0; i < samples; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(unwrapped[i].Value(), chunked[i].Value());
+    }
+
+    // other units and element types
+    tAngleDegUnsigned wrapped_degrees[4] = { tAngleDegUnsigned(350), tAngleDegUnsigned(10), tAngleDegUnsigned(40), tAngleDegUnsigned(300) };
+    tAngle<float, angle::Degree, angle::NoWrap> unwrapped_degrees[4];
+    Unwrap(wrapped_degrees, unwrapped_degrees, 4);
+    RRLIB_UNIT_TESTS_EQUALITY(350.0f, unwrapped_degrees[0].Value());
+    RRLIB_UNIT_TESTS_EQUALITY(370.0f, unwrapped_degrees[1].Value());
+    RRLIB_UNIT_TESTS_EQUALITY(400.0f, unwrapped_degrees[2].Value());
+    RRLIB_UNIT_TESTS_EQUALITY(300.0f, unwrapped_degrees[3].Value());
+
+    tAngleBinary wrapped_binary[3] = { tAngleBinary(0xC0000000u), tAngleBinary(0x40000000u), tAngleBinary(0xC0000000u) };
+    tAngle<double, angle::Binary, angle::NoWrap> unwrapped_binary[3];
+    Unwrap(wrapped_binary, unwrapped_binary, 3);
+    RRLIB_UNIT_TESTS_EQUALITY(3221225472.0, unwrapped_binary[0].Value());
+    RRLIB_UNIT_TESTS_EQUALITY(1073741824.0, unwrapped_binary[1].Value());
+    RRLIB_UNIT_TESTS_EQUALITY(-1073741824.0, unwrapped_binary[2].Value());
+  }
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(TestAngles);
@@ -34,10 +34,20 @@
 #include "rrlib/util/tUnitTestSuite.h"
 
 #include <cstring>
+#include <vector>
 
 #include "rrlib/math/tMatrix.h"
+#include "rrlib/math/tLowerTriangularMatrix.h"
 #include "rrlib/math/tCholeskyDecomposition.h"
 #include "rrlib/math/tLUDecomposition.h"
+#include "rrlib/math/batch_decompositions.h"
+#include "rrlib/math/tBlockSparseMatrix.h"
+#include "rrlib/math/tSparseCholeskyDecomposition.h"
+#include "rrlib/math/conjugate_gradient.h"
+#include "rrlib/math/inverse_updates.h"
+#include "rrlib/math/matrix_exponential.h"
+#include "rrlib/math/schur_complement.h"
+#include "rrlib/math/tSingularValueDecomposition.h"
 
 #ifdef _LIB_RRLIB_SIMVIS3D_MATH_PRESENT_
 #include "rrlib/simvis3d/math_functions.h"
@@ -87,8 +97,24 @@ class TestMatrices : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(ArithmeticOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(Transpose);
   RRLIB_UNIT_TESTS_ADD_TEST(InversionOfHilbertMatrix<5>);
+  RRLIB_UNIT_TESTS_ADD_TEST(LowerTriangularMatrix);
   RRLIB_UNIT_TESTS_ADD_TEST(CholeskyDecomposition);
+  RRLIB_UNIT_TESTS_ADD_TEST(CholeskyUpdate);
   RRLIB_UNIT_TESTS_ADD_TEST(LUDecomposition);
+  RRLIB_UNIT_TESTS_ADD_TEST(DecompositionDeterminantAndInverse);
+  RRLIB_UNIT_TESTS_ADD_TEST(DecompositionKernels<6>);
+  RRLIB_UNIT_TESTS_ADD_TEST(DecompositionKernels<14>);
+  RRLIB_UNIT_TESTS_ADD_TEST(BatchDecompositions);
+  RRLIB_UNIT_TESTS_ADD_TEST(SparseMatrix);
+  RRLIB_UNIT_TESTS_ADD_TEST(SparseCholeskyDecomposition);
+  RRLIB_UNIT_TESTS_ADD_TEST(ConjugateGradient);
+  RRLIB_UNIT_TESTS_ADD_TEST(InverseUpdates);
+  RRLIB_UNIT_TESTS_ADD_TEST(SchurComplement);
+  RRLIB_UNIT_TESTS_ADD_TEST(ConditionNumberEstimation);
+  RRLIB_UNIT_TESTS_ADD_TEST(SingularValueDecomposition);
+  RRLIB_UNIT_TESTS_ADD_TEST(MatrixExponential);
+  RRLIB_UNIT_TESTS_ADD_TEST(Orthonormalization);
+  RRLIB_UNIT_TESTS_ADD_TEST(BatchRollPitchYawConversions);
 #ifdef _LIB_RRLIB_SIMVIS3D_MATH_PRESENT_
   RRLIB_UNIT_TESTS_ADD_TEST(CoinConversions);
 #endif
@@ -197,6 +223,23 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(inverted_hilbert_matrix, hilbert_matrix.Inverted());
   }
 
+  void LowerTriangularMatrix()
+  {
+    tMatrix<3, 3, double> L(1, 0, 0, 2, 1, 0, 3, 1, 4);
+    tLowerTriangularMatrix<3, double> packed(L);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Packed storage holds only the lower triangle", sizeof(double) * 6, sizeof(packed));
+    RRLIB_UNIT_TESTS_EQUALITY(3.0, packed[2][0]);
+    RRLIB_UNIT_TESTS_EQUALITY(L, packed.GetFullMatrix());
+
+    tVector<3, double> x(3, 2, 1);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("L * x = b", x, packed.Solve(L * x));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("L' * x = b", x, packed.SolveTransposed(L.Transposed() * x));
+
+    tMatrix<3, 2, double> X(3, -1, 2, 0.5, 1, 2);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("L * X = B", X, packed.Solve(L * X));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("L' * X = B", X, packed.SolveTransposed(L.Transposed() * X));
+  }
+
   void CholeskyDecomposition()
   {
     tMatrix<3, 3, double> A(1, 2, 3, 2, 5, 7, 3, 7, 26);
@@ -214,6 +257,23 @@ private:
     RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("A is not symmetrical", (tCholeskyDecomposition<2, double>(tMatrix<2, 2, double>(1, 1, -1, 1))), std::logic_error);
   }
 
+  void CholeskyUpdate()
+  {
+    tMatrix<3, 3, double> A(1, 2, 3, 2, 5, 7, 3, 7, 26);
+    tVector<3, double> v(1, -2, 0.5);
+
+    tCholeskyDecomposition<3, double> cholesky(A);
+    cholesky.Update(v);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("chol(A).Update(v).C = chol(A + vv').C", IsEqual(tCholeskyDecomposition<3, double>(A + tMatrix<3, 3, double>(v, v)).C(), cholesky.C(), 1E-9));
+
+    cholesky.Downdate(v);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("chol(A).Update(v).Downdate(v).C = chol(A).C", IsEqual(tCholeskyDecomposition<3, double>(A).C(), cholesky.C(), 1E-9));
+
+    tMatrix<3, 3, double> C(cholesky.C());
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("A - vv' is not positive definite", cholesky.Downdate(tVector<3, double>(2, 0, 0)), std::logic_error);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Failed downdate leaves decomposition unchanged", C, cholesky.C());
+  }
+
   void LUDecomposition()
   {
     tMatrix<3, 3, double> A(
@@ -257,6 +317,665 @@ private:
       -1.0,  0.0
     );
     RRLIB_UNIT_TESTS_EQUALITY((tVector<2, double>(2.0, 1.0)), (tLUDecomposition<2, double>(C).Solve(tVector<3, double>(0.0, 1.0, -2.0))));
+
+    tMatrix<5, 2, double> right_sides(
+      5.0,  1.0,
+      -5.0,  2.0,
+      -2.0,  3.0,
+      -4.0,  4.0,
+      7.0,  5.0
+    );
+    tLUDecomposition<5, double> B_decomposition(B);
+    tMatrix<5, 2, double> solutions(B_decomposition.Solve(right_sides));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tVector<5, double>(2.0, 4.0, 0.5, 3.0, -5.0)), tVector<5, double>(solutions[0][0], solutions[1][0], solutions[2][0], solutions[3][0], solutions[4][0]), 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(B * solutions, right_sides, 1E-9));
+  }
+
+  void DecompositionDeterminantAndInverse()
+  {
+    tMatrix<3, 3, double> A(1, 2, 3, 2, 5, 7, 3, 7, 26);
+    tCholeskyDecomposition<3, double> cholesky(A);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(A.Determinant(), cholesky.Determinant(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::log(A.Determinant()), cholesky.LogDeterminant(), 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(A.Inverted(), cholesky.Inverse(), 1E-9));
+
+    tMatrix<3, 3, double> B(
+      9.0, 3.0,  1.0,
+      4.0, 2.0,  1.0,
+      1.0, 1.0, -1.0
+    );
+    tLUDecomposition<3, double> lu(B);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(B.Determinant(), lu.Determinant(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::log(std::fabs(B.Determinant())), lu.LogDeterminant(), 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(B.Inverted(), lu.Inverse(), 1E-9));
+  }
+
+  template <size_t Tdimension>
+  void DecompositionKernels()
+  {
+    tMatrix<Tdimension, Tdimension, double> C;
+    tVector<Tdimension, double> x;
+    for (size_t row = 0; row < Tdimension; ++row)
+    {
+      for (size_t column = 0; column < row; ++column)
+      {
+        C[row][column] = 0.1 * (row + 1) - 0.05 * column;
+      }
+      C[row][row] = 1 + row % 3;
+      x[row] = 1.0 - 0.5 * row;
+    }
+    tMatrix<Tdimension, Tdimension, double> A(C * C.Transposed());
+
+    tCholeskyDecomposition<Tdimension, double> cholesky(A);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(C, cholesky.C(), 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(x, cholesky.Solve(A * x), 1E-9));
+
+    tLUDecomposition<Tdimension, double> lu(A);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(cholesky.LogDeterminant(), lu.LogDeterminant(), 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(x, lu.Solve(A * x), 1E-9));
+  }
+
+  void BatchDecompositions()
+  {
+    const size_t count = 200;
+    std::vector<double> cholesky_matrices(9 * count), lu_matrices(9 * count), cholesky_right_sides(3 * count), lu_right_sides(3 * count);
+    std::vector<tMatrix<3, 3, double>> matrices;
+    std::vector<tVector<3, double>> right_sides;
+    for (size_t s = 0; s < count; ++s)
+    {
+      tMatrix<3, 3, double> C(1 + s % 3, 0, 0, 0.1 * s, 2, 0, -0.5, 0.01 * s, 1 + s % 5);
+      matrices.push_back(C * C.Transposed());
+      right_sides.push_back(tVector<3, double>(1, -0.5 * s, 2));
+      for (size_t i = 0; i < 9; ++i)
+      {
+        cholesky_matrices[i * count + s] = lu_matrices[i * count + s] = matrices[s][i / 3][i % 3];
+      }
+      for (size_t i = 0; i < 3; ++i)
+      {
+        cholesky_right_sides[i * count + s] = lu_right_sides[i * count + s] = right_sides[s][i];
+      }
+    }
+    cholesky_matrices[4 * count + 7] = -1;
+    for (size_t i = 0; i < 9; ++i)
+    {
+      lu_matrices[i * count + 11] = i < 3 ? 0 : lu_matrices[i * count + 11];
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("One system is not positive definite", size_t(1), BatchCholeskySolve<3>(cholesky_matrices.data(), cholesky_right_sides.data(), count, 2));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("One system is singular", size_t(1), BatchLUSolve<3>(lu_matrices.data(), lu_right_sides.data(), count, 2));
+
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(cholesky_right_sides[count + 7]));
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(lu_right_sides[count + 11]));
+    for (size_t s = 0; s < count; ++s)
+    {
+      if (s == 7 || s == 11)
+      {
+        continue;
+      }
+      tVector<3, double> expected(tLUDecomposition<3, double>(matrices[s]).Solve(right_sides[s]));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, tVector<3, double>(cholesky_right_sides[s], cholesky_right_sides[count + s], cholesky_right_sides[2 * count + s]), 1E-9));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, tVector<3, double>(lu_right_sides[s], lu_right_sides[count + s], lu_right_sides[2 * count + s]), 1E-9));
+    }
+  }
+
+  void SparseMatrix()
+  {
+    std::vector<tSparseMatrix<double>::tEntry> entries = { { 1, 2, 3.0 }, { 0, 0, 1.0 }, { 1, 0, 2.0 }, { 1, 2, 1.0 } };
+    tSparseMatrix<double> A(2, 3, entries);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Duplicate entries are summed up", size_t(3), A.GetNumberOfNonZeros());
+    RRLIB_UNIT_TESTS_EQUALITY(4.0, A(1, 2));
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, A(0, 1));
+
+    tSparseMatrix<double> B(A.Transposed());
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), B.GetNumberOfRows());
+    RRLIB_UNIT_TESTS_EQUALITY(4.0, B(2, 1));
+    RRLIB_UNIT_TESTS_EQUALITY(2.0, B(0, 1));
+
+    double x[3] = { 1, 2, 3 };
+    double y[2];
+    A.Multiply(x, y);
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, y[0]);
+    RRLIB_UNIT_TESTS_EQUALITY(14.0, y[1]);
+
+    RRLIB_UNIT_TESTS_EXCEPTION((tSparseMatrix<double>(2, 2, std::vector<tSparseMatrix<double>::tEntry>(1, { 2, 0, 1.0 }))), std::logic_error);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Row offsets must not decrease", (tSparseMatrix<double>(2, 1000000, { 0, 7, 5 }, { 0, 1, 2, 3, 4 }, std::vector<double>(5, 1.0))), std::logic_error);
+  }
+
+  void SparseCholeskyDecomposition()
+  {
+    // a chain of poses with a loop closure, assembled from 3x3 blocks
+    const size_t poses = 40;
+    typedef tBlockSparseMatrix<3, 3, double> tInformation;
+    std::vector<tInformation::tEntry> entries;
+    tMatrix<3, 3, double> odometry(2, 0.5, 0, 0.5, 2, 0.1, 0, 0.1, 1);
+    for (size_t i = 0; i < poses; ++i)
+    {
+      size_t j = (i + 1) % poses;
+      entries.push_back({ i, i, odometry + tMatrix<3, 3, double>::Identity() });
+      entries.push_back({ j, j, odometry });
+      entries.push_back({ i, j, -0.5 * odometry });
+      entries.push_back({ j, i, -0.5 * odometry.Transposed() });
+    }
+    tInformation information(poses, poses, entries);
+    tSparseMatrix<double> A(information.GetScalarMatrix());
+    RRLIB_UNIT_TESTS_EQUALITY(3 * poses, A.GetNumberOfRows());
+
+    std::vector<double> x(3 * poses), b(3 * poses), block_b(3 * poses);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      x[i] = std::sin(0.3 * i);
+    }
+    A.Multiply(x.data(), b.data());
+    information.Multiply(x.data(), block_b.data());
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Block and scalar products agree", std::equal(b.begin(), b.end(), block_b.begin(), [](double l, double r)
+    {
+      return IsEqual(l, r, 1E-12);
+    }));
+
+    tSparseCholeskyDecomposition<double> cholesky(A);
+    tSparseCholeskyDecomposition<double>::tSymbolicAnalysis block_analysis(A, 3);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("The ordering keeps fill-in low", cholesky.GetSymbolicAnalysis().GetNumberOfNonZeros() < 30 * A.GetNumberOfRows());
+    for (auto solution : { cholesky.Solve(b), tSparseCholeskyDecomposition<double>(block_analysis, A).Solve(b) })
+    {
+      for (size_t i = 0; i < x.size(); ++i)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(x[i], solution[i], 1E-9);
+      }
+    }
+
+    for (auto it = A.GetValues().begin(); it != A.GetValues().end(); ++it)
+    {
+      *it *= 2;
+    }
+    cholesky.Factorize(A);
+    std::vector<double> half(cholesky.Solve(b));
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.5 * x[i], half[i], 1E-9);
+    }
+
+    tMatrix<3, 3, double> dense(1, 2, 3, 2, 5, 7, 3, 7, 26);
+    std::vector<tSparseMatrix<double>::tEntry> dense_entries;
+    for (size_t row = 0; row < 3; ++row)
+    {
+      for (size_t column = 0; column < 3; ++column)
+      {
+        dense_entries.push_back({ row, column, dense[row][column] });
+      }
+    }
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::log(dense.Determinant()), tSparseCholeskyDecomposition<double>(tSparseMatrix<double>(3, 3, dense_entries)).LogDeterminant(), 1E-9);
+    dense_entries[0].value = -1;
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Matrix is not positive definite", tSparseCholeskyDecomposition<double>(tSparseMatrix<double>(3, 3, dense_entries)), std::logic_error);
+
+    std::vector<tSparseMatrix<double>::tEntry> chain_entries = { { 0, 0, 4.0 }, { 1, 1, 4.0 }, { 2, 2, 4.0 }, { 0, 1, 1.0 }, { 1, 0, 1.0 } };
+    tSparseCholeskyDecomposition<double> chain(tSparseMatrix<double>(3, 3, chain_entries));
+    const std::vector<double> chain_values = chain.GetValues();
+    chain_entries[2].value = -4;
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Matrix is not positive definite", chain.Factorize(tSparseMatrix<double>(3, 3, chain_entries)), std::logic_error);
+    chain_entries[2].value = 4;
+    chain_entries.push_back({ 0, 2, 1.0 });
+    chain_entries.push_back({ 2, 0, 1.0 });
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Entries outside the analyzed pattern", chain.Factorize(tSparseMatrix<double>(3, 3, chain_entries)), std::logic_error);
+    chain_entries.resize(3);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Fewer entries than analyzed", chain.Factorize(tSparseMatrix<double>(3, 3, chain_entries)), std::logic_error);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Failed factorizations leave the decomposition unchanged", chain_values == chain.GetValues());
+  }
+
+  struct tLaplacian
+  {
+    size_t dimension;
+    size_t GetNumberOfRows() const
+    {
+      return dimension;
+    }
+    size_t GetNumberOfColumns() const
+    {
+      return dimension;
+    }
+    void Multiply(const double *x, double *y) const
+    {
+      for (size_t i = 0; i < dimension; ++i)
+      {
+        y[i] = 3 * x[i] - (i > 0 ? x[i - 1] : 0) - (i + 1 < dimension ? x[i + 1] : 0);
+      }
+    }
+  };
+
+  void ConjugateGradient()
+  {
+    const size_t poses = 40;
+    typedef tBlockSparseMatrix<3, 3, double> tInformation;
+    std::vector<tInformation::tEntry> entries;
+    tMatrix<3, 3, double> odometry(20, 5, 0, 5, 2, 0.1, 0, 0.1, 1);
+    for (size_t i = 0; i + 1 < poses; ++i)
+    {
+      entries.push_back({ i, i, odometry + tMatrix<3, 3, double>::Identity() });
+      entries.push_back({ i + 1, i + 1, odometry });
+      entries.push_back({ i, i + 1, -0.5 * odometry });
+      entries.push_back({ i + 1, i, -0.5 * odometry });
+    }
+    tInformation information(poses, poses, entries);
+    tSparseMatrix<double> A(information.GetScalarMatrix());
+
+    std::vector<double> x(3 * poses), b(3 * poses);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      x[i] = std::cos(0.2 * i);
+    }
+    A.Multiply(x.data(), b.data());
+
+    std::vector<double> plain(x.size(), 0), jacobi(x.size(), 0), block_jacobi(x.size(), 0);
+    tConjugateGradientResult<double> plain_result = ConjugateGradientSolve(A, b, plain, 1E-10);
+    tConjugateGradientResult<double> jacobi_result = ConjugateGradientSolve(A, b, jacobi, tJacobiPreconditioner<double>(A), 1E-10);
+    tConjugateGradientResult<double> block_jacobi_result = ConjugateGradientSolve(information, b, block_jacobi, tBlockJacobiPreconditioner<3, double>(information), 1E-10);
+    RRLIB_UNIT_TESTS_ASSERT(plain_result.converged && jacobi_result.converged && block_jacobi_result.converged);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Block-Jacobi beats plain CG", block_jacobi_result.iterations < plain_result.iterations);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(x[i], plain[i], 1E-6);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(x[i], jacobi[i], 1E-6);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(x[i], block_jacobi[i], 1E-6);
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Warm start at the solution", size_t(0), ConjugateGradientSolve(A, b, jacobi, tBlockJacobiPreconditioner<3, double>(A), 1E-6).iterations);
+
+    std::vector<double> truncated(x.size(), 0);
+    tConjugateGradientResult<double> truncated_result = ConjugateGradientSolve(A, b, truncated, 1E-10, 2);
+    RRLIB_UNIT_TESTS_ASSERT(!truncated_result.converged && truncated_result.iterations == 2);
+
+    tMatrix<3, 3, double> dense(1, 2, 3, 2, 5, 7, 3, 7, 26);
+    std::vector<double> dense_solution(3, 0);
+    ConjugateGradientSolve(tDenseOperator<3, double>(dense), std::vector<double> { 10, 23, 49 }, dense_solution, tJacobiPreconditioner<double>(dense), 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tVector<3, double>(3, 2, 1)), tVector<3, double>(dense_solution.data()), 1E-9));
+    tDenseOperator<3, double> scaled_operator(2.0 * dense);
+    std::fill(dense_solution.begin(), dense_solution.end(), 0);
+    ConjugateGradientSolve(scaled_operator, std::vector<double> { 20, 46, 98 }, dense_solution, tJacobiPreconditioner<double>(dense), 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Operator built from a temporary", IsEqual((tVector<3, double>(3, 2, 1)), tVector<3, double>(dense_solution.data()), 1E-9));
+
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Operator of other dimension", ConjugateGradientSolve(A, std::vector<double>(3, 1), dense_solution), std::logic_error);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Dense operator of other dimension", ConjugateGradientSolve(scaled_operator, b, plain), std::logic_error);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Preconditioner of other dimension", ConjugateGradientSolve(scaled_operator, std::vector<double> { 20, 46, 98 }, dense_solution, tJacobiPreconditioner<double>(A)), std::logic_error);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Block preconditioner of other dimension", ConjugateGradientSolve(information, b, plain, tBlockJacobiPreconditioner<3, double>(std::vector<tMatrix<3, 3, double>>(1, dense))), std::logic_error);
+
+    tLaplacian laplacian = { 100 };
+    std::vector<double> ones(100, 1), laplacian_solution(100, 0), check(100);
+    RRLIB_UNIT_TESTS_ASSERT(ConjugateGradientSolve(laplacian, ones, laplacian_solution, 1E-12).converged);
+    laplacian.Multiply(laplacian_solution.data(), check.data());
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1.0, check[50], 1E-9);
+  }
+
+  void InverseUpdates()
+  {
+    tMatrix<4, 4, double> A(
+      4, 1, 0, 2,
+      1, 5, 1, 0,
+      0, 1, 6, 1,
+      2, 0, 1, 7
+    );
+    tMatrix<4, 4, double> inverse(A.Inverted());
+
+    tVector<4, double> u(1, -1, 0.5, 2), v(0.5, 0, 1, -0.25);
+    tMatrix<4, 4, double> expected(A + tMatrix<4, 4, double>(u, v));
+    RRLIB_UNIT_TESTS_ASSERT(UpdateInverse(A, inverse, u, v));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, A, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.Inverted(), inverse, 1E-9));
+
+    tMatrix<4, 2, double> U(1, 0, 0, 1, 1, 1, 0, 2);
+    tMatrix<2, 4, double> V(0.5, 0.5, 0, 0, 0, 1, -1, 0.5);
+    expected = A + U * V;
+    RRLIB_UNIT_TESTS_ASSERT(UpdateInverse(A, inverse, U, V));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, A, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.Inverted(), inverse, 1E-9));
+
+    tMatrix<4, 4, double> B(tMatrix<4, 4, double>::Identity());
+    tMatrix<4, 4, double> B_inverse(B);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Nearly singular update falls back to recomputation", !UpdateInverse(B, B_inverse, tVector<4, double>(1, 0, 0, 0), tVector<4, double>(-1 + 1E-8, 0, 0, 0)));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(B.Inverted(), B_inverse, 1E-6, eFCM_RELATIVE_ERROR));
+
+    B.SetIdentity();
+    B_inverse.SetIdentity();
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Singular update", UpdateInverse(B, B_inverse, tVector<4, double>(1, 0, 0, 0), tVector<4, double>(-1, 0, 0, 0)), std::logic_error);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Failed update leaves the matrix unchanged", IsEqual(tMatrix<4, 4, double>::Identity(), B));
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Failed update leaves the inverse unchanged", IsEqual(tMatrix<4, 4, double>::Identity(), B_inverse));
+    tMatrix<4, 1, double> singular_U(1, 0, 0, 0);
+    tMatrix<1, 4, double> singular_V(-1, 0, 0, 0);
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Singular rank-k update", UpdateInverse(B, B_inverse, singular_U, singular_V), std::logic_error);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tMatrix<4, 4, double>::Identity(), B) && IsEqual(tMatrix<4, 4, double>::Identity(), B_inverse));
+  }
+
+  void SchurComplement()
+  {
+    tMatrix<6, 6, double> M;
+    tVector<6, double> b;
+    for (size_t row = 0; row < 6; ++row)
+    {
+      b[row] = 0.5 * row - 1;
+      for (size_t column = 0; column < 6; ++column)
+      {
+        M[row][column] = 1.0 / (row + column + 1) + (row == column ? 1 : 0);
+      }
+    }
+
+    tMatrix<4, 4, double> A;
+    tMatrix<2, 4, double> C;
+    tMatrix<2, 2, double> D;
+    tVector<4, double> a;
+    tVector<2, double> d;
+    for (size_t row = 0; row < 6; ++row)
+    {
+      for (size_t column = 0; column < 6; ++column)
+      {
+        if (row < 4 && column < 4)
+        {
+          A[row][column] = M[row][column];
+        }
+        else if (row >= 4 && column < 4)
+        {
+          C[row - 4][column] = M[row][column];
+        }
+        else if (row >= 4)
+        {
+          D[row - 4][column - 4] = M[row][column];
+        }
+      }
+      row < 4 ? a[row] = b[row] : d[row - 4] = b[row];
+    }
+    tMatrix<4, 4, double> expected_matrix(A - C.Transposed() * D.Inverted() * C);
+    tVector<4, double> expected_vector(a - C.Transposed() * (D.Inverted() * d));
+
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_matrix, (rrlib::math::SchurComplement<4, 2>(M)), 1E-12));
+
+    tMatrix<4, 4, double> reduced_matrix;
+    tVector<4, double> reduced_vector;
+    rrlib::math::SchurComplement<4, 2>(M, b, reduced_matrix, reduced_vector);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_matrix, reduced_matrix, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_vector, reduced_vector, 1E-12));
+
+    rrlib::math::SchurComplement(A, a, C, d, tCholeskyDecomposition<2, double>(D));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_matrix, A, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_vector, a, 1E-12));
+
+    std::vector<double> data(reinterpret_cast<const double *>(&M), reinterpret_cast<const double *>(&M) + 36);
+    std::vector<double> vector_data(reinterpret_cast<const double *>(&b), reinterpret_cast<const double *>(&b) + 6);
+    for (size_t row = 0; row < 6; ++row)
+    {
+      for (size_t column = row + 1; column < 6; ++column)
+      {
+        data[row * 6 + column] = 0;
+      }
+    }
+    SchurComplementInPlace(data.data(), vector_data.data(), 6, 4);
+    for (size_t row = 0; row < 4; ++row)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_vector[row], vector_data[row], 1E-12));
+      for (size_t column = 0; column < 4; ++column)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_matrix[row][column], data[row * 6 + column], 1E-12));
+      }
+    }
+
+    M[5][5] = -1;
+    RRLIB_UNIT_TESTS_EXCEPTION_MESSAGE("Marginalized block not positive definite", (rrlib::math::SchurComplement<4, 2>(M)), std::logic_error);
+  }
+
+  template <size_t Tdimension>
+  static double OneNorm(const tMatrix<Tdimension, Tdimension, double> &matrix)
+  {
+    double norm = 0;
+    for (size_t column = 0; column < Tdimension; ++column)
+    {
+      double sum = 0;
+      for (size_t row = 0; row < Tdimension; ++row)
+      {
+        sum += std::fabs(matrix[row][column]);
+      }
+      norm = std::max(norm, sum);
+    }
+    return norm;
+  }
+
+  void ConditionNumberEstimation()
+  {
+    tMatrix<5, 5, double> hilbert_matrix;
+    for (size_t row = 0; row < 5; ++row)
+    {
+      for (size_t column = 0; column < 5; ++column)
+      {
+        hilbert_matrix[row][column] = 1.0 / (row + column + 1);
+      }
+    }
+    const double hilbert_condition = OneNorm(hilbert_matrix) * OneNorm(hilbert_matrix.Inverted());
+    tCholeskyDecomposition<5, double> cholesky(hilbert_matrix);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(hilbert_condition, cholesky.EstimatedConditionNumber(), 1E-6, eFCM_RELATIVE_ERROR));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(hilbert_condition, tLUDecomposition<5, double>(hilbert_matrix).EstimatedConditionNumber(), 1E-6, eFCM_RELATIVE_ERROR));
+
+    tMatrix<4, 4, double> matrix(
+      2, -1, 0, 3,
+      1, 4, -2, 0,
+      0, 1, 5, -1,
+      -3, 0, 1, 6
+    );
+    const double condition = OneNorm(matrix) * OneNorm(matrix.Inverted());
+    const double estimate = tLUDecomposition<4, double>(matrix).EstimatedConditionNumber();
+    RRLIB_UNIT_TESTS_ASSERT(estimate <= condition * (1 + 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(estimate >= condition / 3);
+
+    tVector<5, double> vector(0.5, -1, 0.25, 0, 2);
+    cholesky.Update(vector);
+    const double updated_condition = OneNorm(cholesky.C() * cholesky.C().Transposed()) * OneNorm(cholesky.Inverse());
+    RRLIB_UNIT_TESTS_ASSERT(cholesky.EstimatedConditionNumber() >= updated_condition / 3);
+  }
+
+  void SingularValueDecomposition()
+  {
+    tMatrix<4, 3, double> matrix(
+      2, -1, 0,
+      1, 3, 1,
+      0, 1, 4,
+      -1, 2, 1
+    );
+    tSingularValueDecomposition<4, 3, double> svd(matrix);
+    tMatrix<3, 3, double> singular_values;
+    for (size_t i = 0; i < 3; ++i)
+    {
+      singular_values[i][i] = svd.SingularValues()[i];
+      RRLIB_UNIT_TESTS_ASSERT(i == 0 || svd.SingularValues()[i - 1] >= svd.SingularValues()[i]);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(matrix, svd.U() * singular_values * svd.V().Transposed(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<3, 3, double>::Identity()), svd.U().Transposed() * svd.U(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<3, 3, double>::Identity()), svd.V().Transposed() * svd.V(), 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), svd.Rank());
+
+    tMatrix<3, 3, double> square(4, 1, 0, 1, 5, 2, 0, 2, 6);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(square.Inverted(), tSingularValueDecomposition<3, 3, double>(square).PseudoInverse(), 1E-12));
+
+    tMatrix<2, 4, double> wide(
+      1, 2, 0, -1,
+      2, 4, 1, 0
+    );
+    tSingularValueDecomposition<2, 4, double> wide_svd(wide);
+    tMatrix<4, 2, double> pseudo_inverse(wide_svd.PseudoInverse());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(wide, wide * pseudo_inverse * wide, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pseudo_inverse, pseudo_inverse * wide * pseudo_inverse, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<2, 2, double>::Identity()), wide * pseudo_inverse, 1E-12));
+
+    tMatrix<4, 4, double> basis;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), wide_svd.NullSpace(basis));
+    tMatrix<4, 2, double> null_space(wide_svd.NullSpace<2>());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<2, 2, double>()), wide * null_space, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<2, 2, double>::Identity()), null_space.Transposed() * null_space, 1E-12));
+    for (size_t row = 0; row < 4; ++row)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(null_space[row][0], basis[row][0]) && IsEqual(basis[row][2], 0) && IsEqual(basis[row][3], 0));
+    }
+
+    tMatrix<3, 3, double> singular(1, 2, 3, 2, 4, 6, 1, 0, 1);
+    tSingularValueDecomposition<3, 3, double> singular_svd(singular);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), singular_svd.Rank());
+    tMatrix<3, 3, double> singular_pseudo_inverse(singular_svd.PseudoInverse());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(singular, singular * singular_pseudo_inverse * singular, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((singular * singular_pseudo_inverse).Transposed(), singular * singular_pseudo_inverse, 1E-12));
+  }
+
+  void MatrixExponential()
+  {
+    const double angle = 2.5;
+    tMatrix<2, 2, double> generator(0, -angle, angle, 0);
+    tMatrix<2, 2, double> rotation(std::cos(angle), -std::sin(angle), std::sin(angle), std::cos(angle));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotation, rrlib::math::MatrixExponential(generator), 1E-14));
+
+    tMatrix<3, 3, double> diagonal(5, 0, 0, 0, -3, 0, 0, 0, 0);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tMatrix<3, 3, double>(std::exp(5), 0, 0, 0, std::exp(-3), 0, 0, 0, 1), rrlib::math::MatrixExponential(diagonal), 1E-14, eFCM_RELATIVE_ERROR));
+
+    tMatrix<4, 4, double> matrix(
+      0.5, -2, 1, 3,
+      1, -1, 0.25, 0,
+      -4, 2, 1, 1,
+      0, 1, -2, -3
+    );
+    tMatrix<4, 4, double> exponential(rrlib::math::MatrixExponential(matrix));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual((tMatrix<4, 4, double>::Identity()), exponential * rrlib::math::MatrixExponential(-matrix), 1E-10));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(exponential, rrlib::math::MatrixExponential(0.5 * matrix) * rrlib::math::MatrixExponential(0.5 * matrix), 1E-10, eFCM_RELATIVE_ERROR));
+
+    double dynamic_exponential[16];
+    rrlib::math::MatrixExponential(reinterpret_cast<const double *>(&matrix), 4, dynamic_exponential);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(exponential, tMatrix<4, 4, double>(dynamic_exponential), 1E-14));
+
+    const double dt = 0.1;
+    const double q = 2;
+    tMatrix<2, 2, double> transition;
+    tMatrix<2, 2, double> discrete_noise;
+    DiscretizeLinearSystem(tMatrix<2, 2, double>(0, 1, 0, 0), tMatrix<2, 2, double>(0, 0, 0, q), dt, transition, discrete_noise);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tMatrix<2, 2, double>(1, dt, 0, 1), transition, 1E-14));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(q * tMatrix<2, 2, double>(dt * dt * dt / 3, dt * dt / 2, dt * dt / 2, dt), discrete_noise, 1E-14));
+
+    tMatrix<4, 4, double> noise(tMatrix<4, 4, double>::Identity());
+    tMatrix<4, 4, double> noise_transition;
+    tMatrix<4, 4, double> noise_discrete;
+    DiscretizeLinearSystem(matrix, noise, dt, noise_transition, noise_discrete);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(rrlib::math::MatrixExponential(dt * matrix), noise_transition, 1E-14));
+    double dynamic_transition[16];
+    double dynamic_discrete[16];
+    DiscretizeLinearSystem(reinterpret_cast<const double *>(&matrix), reinterpret_cast<const double *>(&noise), 4, dt, dynamic_transition, dynamic_discrete);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(noise_discrete, tMatrix<4, 4, double>(dynamic_discrete), 1E-14));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(noise_discrete, noise_discrete.Transposed(), 0));
+  }
+
+  void Orthonormalization()
+  {
+    tMatrix<3, 3, double> rotation(Get3DRotationMatrixFromRollPitchYaw<double>(tAngleRad(0.3), tAngleRad(-1.1), tAngleRad(2.4)));
+    tMatrix<3, 3, double> stretch(1E-4, 2E-5, -3E-5, 2E-5, -5E-5, 1E-5, -3E-5, 1E-5, 2E-4);
+    tMatrix<3, 3, double> drifted(rotation * (tMatrix<3, 3, double>::Identity() + stretch));
+    const tMatrix<3, 3, double> identity(tMatrix<3, 3, double>::Identity());
+
+    tMatrix<3, 3, double> polar(drifted);
+    polar.OrthonormalizePolar();
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotation, polar, 1E-14));
+
+    tMatrix<3, 3, double> gram_schmidt(drifted);
+    gram_schmidt.OrthonormalizeGramSchmidt();
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(identity, gram_schmidt * gram_schmidt.Transposed(), 1E-14));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(1.0, gram_schmidt.Determinant(), 1E-14));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(drifted.GetRow(0).Normalized(), gram_schmidt.GetRow(0), 1E-14));
+
+    tMatrix<3, 3, double> first_order(drifted);
+    first_order.OrthonormalizeFirstOrder();
+    RRLIB_UNIT_TESTS_ASSERT(!IsEqual(identity, drifted * drifted.Transposed(), 1E-4));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(identity, first_order * first_order.Transposed(), 1E-7));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotation, first_order, 1E-3));
+
+    tMatrix<3, 3, double> matrices[3] = { drifted, drifted, drifted };
+    OrthonormalizePolar(matrices, 1);
+    OrthonormalizeGramSchmidt(matrices + 1, 1);
+    OrthonormalizeFirstOrder(matrices + 2, 1);
+    RRLIB_UNIT_TESTS_EQUALITY(polar, matrices[0]);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(gram_schmidt, matrices[1], 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(identity, matrices[2] * matrices[2].Transposed(), 1E-7));
+  }
+
+  void BatchRollPitchYawConversions()
+  {
+    const size_t cCOUNT = 100;
+    double x[cCOUNT], y[cCOUNT], z[cCOUNT], roll[cCOUNT], pitch[cCOUNT], yaw[cCOUNT];
+    tAngleRad roll_angles[cCOUNT], pitch_angles[cCOUNT], yaw_angles[cCOUNT];
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      x[i] = 0.1 * i;
+      y[i] = -0.3 * i;
+      z[i] = 1.5;
+      roll[i] = std::fmod(0.37 * i, 2 * M_PI) - M_PI;
+      pitch[i] = std::fmod(0.11 * i, 3) - 1.5;
+      yaw[i] = std::fmod(0.73 * i, 2 * M_PI) - M_PI;
+      roll_angles[i] = tAngleRad(roll[i]);
+      pitch_angles[i] = tAngleRad(pitch[i]);
+      yaw_angles[i] = tAngleRad(yaw[i]);
+    }
+
+    tMatrix<3, 3, double> rotations[cCOUNT];
+    tMatrix<3, 3, double> angle_rotations[cCOUNT];
+    tMatrix<4, 4, double> transformations[cCOUNT];
+    Get3DRotationMatricesFromRollPitchYaw(roll, pitch, yaw, rotations, cCOUNT);
+    Get3DRotationMatricesFromRollPitchYaw(roll_angles, pitch_angles, yaw_angles, angle_rotations, cCOUNT);
+    Get4DTransformationMatricesZYXT(x, y, z, roll, pitch, yaw, transformations, cCOUNT);
+
+    double extracted_roll[cCOUNT], extracted_pitch[cCOUNT], extracted_yaw[cCOUNT];
+    ExtractRollPitchYaw(rotations, extracted_roll, extracted_pitch, extracted_yaw, cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Get3DRotationMatrixFromRollPitchYaw<double>(roll_angles[i], pitch_angles[i], yaw_angles[i]), rotations[i], 1E-15));
+      RRLIB_UNIT_TESTS_EQUALITY(rotations[i], angle_rotations[i]);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Get4DTransformationMatrixZYXT<double>(x[i], y[i], z[i], roll_angles[i], pitch_angles[i], yaw_angles[i]), transformations[i], 1E-14));
+
+      tAngleRad expected_roll, expected_pitch, expected_yaw;
+      rotations[i].ExtractRollPitchYaw(expected_roll, expected_pitch, expected_yaw);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_roll.Value(), extracted_roll[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_pitch.Value(), extracted_pitch[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_yaw.Value(), extracted_yaw[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(roll[i], extracted_roll[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pitch[i], extracted_pitch[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(yaw[i], extracted_yaw[i], 1E-12));
+    }
+
+    // the trigonometry policy is used for all sines, cosines and arcus tangents
+    tMatrix<3, 3, double> approximated_rotations[cCOUNT];
+    tMatrix<4, 4, double> approximated_transformations[cCOUNT];
+    Get3DRotationMatricesFromRollPitchYaw<angle::Polynomial<4>>(roll, pitch, yaw, approximated_rotations, cCOUNT);
+    Get4DTransformationMatricesZYXT<angle::Polynomial<4>>(x, y, z, roll, pitch, yaw, approximated_transformations, cCOUNT);
+    ExtractRollPitchYaw<angle::Polynomial<4>>(rotations, extracted_roll, extracted_pitch, extracted_yaw, cCOUNT);
+    double maximum_difference = 0;
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotations[i], approximated_rotations[i], 1E-4));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(transformations[i], approximated_transformations[i], 1E-3));
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(roll[i] - extracted_roll[i]) < 1E-4);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(pitch[i] - extracted_pitch[i]) < 1E-4);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(yaw[i] - extracted_yaw[i]) < 1E-4);
+      maximum_difference = std::max(maximum_difference, std::fabs(rotations[i][0][0] - approximated_rotations[i][0][0]) + std::fabs(yaw[i] - extracted_yaw[i]));
+    }
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("The approximation is actually used", maximum_difference > 1E-9);
+
+    // without roll, pitch and yaw only differ if their arcus tangents use the policy
+    double pitch_difference = 0, yaw_difference = 0, second_roll_difference = 0;
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      tMatrix<3, 3, double> rotation(Get3DRotationMatrixFromRollPitchYaw<double>(tAngleRad(0), pitch_angles[i], yaw_angles[i]));
+      tAngleRad exact_roll, exact_pitch, exact_yaw, approximated_roll, approximated_pitch, approximated_yaw;
+      rotation.ExtractRollPitchYaw(exact_roll, exact_pitch, exact_yaw);
+      rotation.ExtractRollPitchYaw<angle::Polynomial<4>>(approximated_roll, approximated_pitch, approximated_yaw);
+      RRLIB_UNIT_TESTS_EQUALITY(0.0, approximated_roll.Value());
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(exact_pitch.Value() - approximated_pitch.Value()) < 1E-4);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(exact_yaw.Value() - approximated_yaw.Value()) < 1E-4);
+      pitch_difference = std::max(pitch_difference, std::fabs(exact_pitch.Value() - approximated_pitch.Value()));
+      yaw_difference = std::max(yaw_difference, std::fabs(exact_yaw.Value() - approximated_yaw.Value()));
+
+      rotations[i].ExtractRollPitchYaw(exact_roll, exact_pitch, exact_yaw, true);
+      rotations[i].ExtractRollPitchYaw<angle::Polynomial<4>>(approximated_roll, approximated_pitch, approximated_yaw, true);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(tAngleRad(exact_roll.Value() - approximated_roll.Value()).Value()) < 1E-4);
+      second_roll_difference = std::max(second_roll_difference, std::fabs(tAngleRad(exact_roll.Value() - approximated_roll.Value()).Value()));
+    }
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Pitch uses the policy", pitch_difference > 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Yaw uses the policy", yaw_difference > 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE("The second solution uses the policy", second_roll_difference > 1E-9);
   }
 
 #ifdef _LIB_RRLIB_SIMVIS3D_MATH_PRESENT_
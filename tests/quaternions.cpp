@@ -0,0 +1,233 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/math/test/unit_test_quaternions.cpp
+ *
+ * \author  Tobias Foehst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <sstream>
+
+#include "rrlib/math/tQuaternion.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace math
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+class TestQuaternions : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestQuaternions);
+  RRLIB_UNIT_TESTS_ADD_TEST(Constructors);
+  RRLIB_UNIT_TESTS_ADD_TEST(Conversions);
+  RRLIB_UNIT_TESTS_ADD_TEST(Composition);
+  RRLIB_UNIT_TESTS_ADD_TEST(Interpolation);
+  RRLIB_UNIT_TESTS_ADD_TEST(BatchOperations);
+  RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void Constructors()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(4 * sizeof(double), sizeof(tQuaternion<double>));
+
+    tQuaternion<double> identity;
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(1, 0, 0, 0), identity));
+
+    tQuaternion<double> quarter_turn(tVec3d(0, 0, 2), tAngleDeg(90));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(std::sqrt(0.5), 0, 0, std::sqrt(0.5)), quarter_turn, 1E-12));
+    RRLIB_UNIT_TESTS_EXCEPTION(tQuaternion<double>(tVec3d(0, 0, 0), tAngleRad(1)), std::logic_error);
+
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(-1, 2, -3, 4).Normalized().Norm(), 1.0, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(-1, 2, -3, 4) * tQuaternion<double>(-1, 2, -3, 4).Inverted(), identity, 1E-12));
+  }
+
+  void Conversions()
+  {
+    const tAngleRad roll(0.3), pitch(-1.1), yaw(2.4);
+    tMatrix<3, 3, double> matrix(Get3DRotationMatrixFromRollPitchYaw<double>(roll, pitch, yaw));
+    tQuaternion<double> quaternion(roll, pitch, yaw);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(matrix, quaternion.GetRotationMatrix(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(quaternion, tQuaternion<double>(matrix), 1E-12));
+
+    tAngleRad extracted_roll, extracted_pitch, extracted_yaw;
+    quaternion.ExtractRollPitchYaw(extracted_roll, extracted_pitch, extracted_yaw);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(roll.Value(), extracted_roll.Value(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pitch.Value(), extracted_pitch.Value(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(yaw.Value(), extracted_yaw.Value(), 1E-12));
+
+    tVec3d axis;
+    tAngleRad angle;
+    quaternion.GetRotation(axis, angle);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(quaternion, tQuaternion<double>(axis, angle), 1E-12));
+
+    // cover all branches of the conversion from matrices
+    const tVec3d axes[4] = { tVec3d(1, 0.2, -0.1), tVec3d(0.1, 1, 0.3), tVec3d(-0.2, 0.1, 1), tVec3d(1, 1, 1) };
+    for (size_t i = 0; i < 4; ++i)
+    {
+      tQuaternion<double> half_turn(axes[i], tAngleDeg(179));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(half_turn, tQuaternion<double>(half_turn.GetRotationMatrix()), 1E-12));
+    }
+
+    // the axis/angle functions of matrices go through quaternions
+    tMatrix<4, 4, double> homogeneous;
+    homogeneous.SetRotation(tVec3d(1, 2, 2), tAngleDeg(100));
+    tQuaternion<double> expected(tVec3d(1, 2, 2), tAngleDeg(100));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.GetRotationMatrix(), tMatrix<3, 3, double>(homogeneous[0][0], homogeneous[0][1], homogeneous[0][2],
+                            homogeneous[1][0], homogeneous[1][1], homogeneous[1][2], homogeneous[2][0], homogeneous[2][1], homogeneous[2][2]), 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, homogeneous[3][3]);
+    homogeneous.GetRotation(axis, angle);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVec3d(1, 2, 2).Normalized(), axis, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(100 * M_PI / 180, angle.Value(), 1E-12));
+    expected.GetRotationMatrix().GetRotation(axis, angle);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(expected, tQuaternion<double>(axis, angle), 1E-12));
+  }
+
+  void Composition()
+  {
+    tQuaternion<double> first(tAngleRad(0.3), tAngleRad(-1.1), tAngleRad(2.4));
+    tQuaternion<double> second(tVec3d(1, -2, 0.5), tAngleDeg(35));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(first.GetRotationMatrix() * second.GetRotationMatrix(), (first * second).GetRotationMatrix(), 1E-12));
+
+    tQuaternion<double> composed(first);
+    composed *= second;
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(first * second, composed));
+
+    tVec3d vector(0.7, -1.5, 2);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(first.GetRotationMatrix() * vector, first.Rotate(vector), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(vector, first.Conjugated().Rotate(first.Rotate(vector)), 1E-12));
+  }
+
+  void Interpolation()
+  {
+    tVec3d axis(0.3, -0.4, 1);
+    tQuaternion<double> first(axis, tAngleDeg(10));
+    tQuaternion<double> second(axis, tAngleDeg(130));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(axis, tAngleDeg(40)), Slerp(first, second, 0.25), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(first, Slerp(first, second, 0.0), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(second, Slerp(first, second, 1.0), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(axis, tAngleDeg(70)), Nlerp(first, second, 0.5), 1E-12));
+
+    tQuaternion<double> negated(-second.W(), -second.X(), -second.Y(), -second.Z());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(tQuaternion<double>(axis, tAngleDeg(40)), Slerp(first, negated, 0.25), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(tQuaternion<double>(axis, tAngleDeg(70)), Nlerp(first, negated, 0.5), 1E-12));
+
+    tQuaternion<double> close(axis, tAngleDeg(10.5));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(axis, tAngleDeg(10.25)), Slerp(first, close, 0.5), 1E-9));
+  }
+
+  void BatchOperations()
+  {
+    tQuaternion<double> quaternions[3] = { tQuaternion<double>(tAngleRad(0.3), tAngleRad(-1.1), tAngleRad(2.4)), tQuaternion<double>(tVec3d(1, 0, 0), tAngleDeg(90)), tQuaternion<double>() };
+    tQuaternion<double> others[3] = { tQuaternion<double>(tVec3d(0, 1, 0), tAngleDeg(-30)), tQuaternion<double>(tVec3d(1, 1, 0), tAngleDeg(45)), tQuaternion<double>(tVec3d(0, 0, 1), tAngleDeg(180)) };
+
+    tQuaternion<double> result[3];
+    Multiply(quaternions, others, result, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(quaternions[i] * others[i], result[i]));
+    }
+    Slerp(quaternions, others, 0.3, result, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Slerp(quaternions[i], others[i], 0.3), result[i]));
+    }
+    Nlerp(quaternions, others, 0.3, result, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Nlerp(quaternions[i], others[i], 0.3), result[i]));
+    }
+
+    tMatrix<3, 3, double> matrices[3];
+    GetRotationMatrices(quaternions, matrices, 3);
+    GetQuaternions(matrices, result, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(quaternions[i].GetRotationMatrix(), matrices[i]));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqualRotation(quaternions[i], result[i], 1E-12));
+    }
+
+    tVec3d vectors[3] = { tVec3d(1, 0, 0), tVec3d(0.5, -2, 1), tVec3d(0, 0, 3) };
+    tVec3d rotated[3];
+    quaternions[0].Rotate(vectors, rotated, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(matrices[0] * vectors[i], rotated[i], 1E-12));
+    }
+    quaternions[0].Rotate(vectors, vectors, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotated[i], vectors[i]));
+    }
+  }
+
+  void Streaming()
+  {
+    std::stringstream stream;
+    stream << tQuaternion<double>(1, -2, 3.5, 0);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("(1, -2, 3.5, 0)"), stream.str());
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestQuaternions);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -35,6 +35,10 @@
 #include "rrlib/util/tUnitTestSuite.h"
 
 #include "rrlib/math/tVector.h"
+#include "rrlib/math/tVectorRotator.h"
+#include "rrlib/math/tSinCos.h"
+
+#include <vector>
 
 #ifdef _LIB_RRLIB_SIMVIS3D_MATH_PRESENT_
 #include "rrlib/simvis3d/math_functions.h"
@@ -87,6 +91,8 @@ class TestVectors : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(PolarAssignments);
   RRLIB_UNIT_TESTS_ADD_TEST(PolarOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
+  RRLIB_UNIT_TESTS_ADD_TEST(Rotator);
+  RRLIB_UNIT_TESTS_ADD_TEST(RotationsWithSinCos);
 #ifdef _LIB_RRLIB_SIMVIS3D_MATH_PRESENT_
   RRLIB_UNIT_TESTS_ADD_TEST(CoinConversions);
 #endif
@@ -429,6 +435,65 @@ private:
 #endif
   }
 
+  void Rotator()
+  {
+    tVec3d axis(0.3, -1, 2);
+    tAngleRad angle(1.2);
+    tVec3d vectors[4] = { tVec3d(1, 0, 0), tVec3d(0, 1, 0), tVec3d(0.5, -2, 3), tVec3d(-1, -1, 0.25) };
+
+    tVectorRotator<double> rotator(angle, axis);
+    for (size_t i = 0; i < 4; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(vectors[i].Rotated(angle, axis), rotator.Rotated(vectors[i]), 1E-12));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(rotator.GetMatrix(), tVectorRotator<double>(tQuaternion<double>(axis, angle)).GetMatrix(), 1E-12));
+    RRLIB_UNIT_TESTS_EXCEPTION(tVectorRotator<double>(angle, tVec3d(0, 0, 0)), std::logic_error);
+
+    std::vector<tVec3d> range(vectors, vectors + 4);
+    std::vector<tVec3d> rotated_range(4);
+    RRLIB_UNIT_TESTS_ASSERT(rotator.Rotate(range.begin(), range.end(), rotated_range.begin()) == rotated_range.end());
+    rotator.Rotate(range.begin(), range.end());
+    double x[4], y[4], z[4];
+    for (size_t i = 0; i < 4; ++i)
+    {
+      x[i] = vectors[i].X();
+      y[i] = vectors[i].Y();
+      z[i] = vectors[i].Z();
+    }
+    rotator.Rotate(x, y, z, 4);
+    for (size_t i = 0; i < 4; ++i)
+    {
+      tVec3d expected(vectors[i].Rotated(angle, axis));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, rotated_range[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, range[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, tVec3d(x[i], y[i], z[i]), 1E-12));
+    }
+  }
+
+  void RotationsWithSinCos()
+  {
+    tVec3d axis(0.3, -1, 2);
+    for (double value = -3.1; value < 3.2; value += 0.7)
+    {
+      tAngleRad angle(value);
+      tSinCos<> sin_cos(angle);
+
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVec2d(1, 2).Rotated(angle), tVec2d(1, 2).Rotated(sin_cos), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVec3d(1, 2, 3).Rotated(angle, axis), tVec3d(1, 2, 3).Rotated(sin_cos, axis), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Get2DRotationMatrix<double>(angle), Get2DRotationMatrix<double>(sin_cos), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Get3DRotationMatrixFromRollPitchYaw<double>(angle, -angle, angle / 2), Get3DRotationMatrixFromRollPitchYaw<double>(sin_cos, -sin_cos, tSinCos<>(angle / 2)), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Get4DTransformationMatrixZYXT<double>(1, 2, 3, angle, -angle, angle), Get4DTransformationMatrixZYXT<double>(1, 2, 3, sin_cos, -sin_cos, sin_cos), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVectorRotator<double>(angle, axis).GetMatrix(), tVectorRotator<double>(sin_cos, axis).GetMatrix(), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(axis, angle), tQuaternion<double>(axis, sin_cos), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternion<double>(angle, -angle, angle), tQuaternion<double>(sin_cos, -sin_cos, sin_cos), 1E-12));
+
+      tMat4x4d expected, actual;
+      expected.SetRotation(axis, angle);
+      actual.SetRotation(axis, sin_cos);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, actual, 1E-12));
+    }
+  }
+
   void Streaming()
   {
     std::stringstream actual;
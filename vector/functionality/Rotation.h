@@ -47,6 +47,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/math/tAngle.h"
+#include "rrlib/math/tSinCos.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -109,6 +110,14 @@ class Rotation<2, TElement, Cartesian>
 public:
 
   inline void Rotate(tAngleRad angle)
+  {
+    double sine, cosine;
+    angle.SinCos(sine, cosine);
+    this->Rotate(sine, cosine);
+  }
+
+  template <typename TSinCosElement>
+  inline void Rotate(const tSinCos<TSinCosElement> &angle)
   {
     this->Rotate(angle.Sine(), angle.Cosine());
   }
@@ -128,6 +137,12 @@ public:
     return temp;
   }
 
+  template <typename TSinCosElement>
+  inline const tVector Rotated(const tSinCos<TSinCosElement> &angle) const
+  {
+    return this->Rotated(angle.Sine(), angle.Cosine());
+  }
+
   inline const tVector Rotated(double sine, double cosine) const
   {
     const tVector *that = reinterpret_cast<const tVector *>(this);
@@ -169,17 +184,23 @@ public:
 
   template <typename TAxisElement>
   inline void Rotate(tAngleRad angle, const math::tVector<3, TAxisElement, Cartesian> &axis)
+  {
+    this->Rotate(tSinCos<double>(angle), axis);
+  }
+
+  template <typename TSinCosElement, typename TAxisElement>
+  inline void Rotate(const tSinCos<TSinCosElement> &angle, const math::tVector<3, TAxisElement, Cartesian> &axis)
   {
     tVector *that = reinterpret_cast<tVector *>(this);
 
     double si = angle.Sine();
     double co = angle.Cosine();
-    double mco = 1.0 - co;
     math::tVector<3, TAxisElement, Cartesian> normalized_axis(axis.Normalized());
+    double projection = (1.0 - co) * (normalized_axis * *that);
 
-    that->Set(co * that->X() + (normalized_axis.X() * mco) * normalized_axis **that + si * (normalized_axis.Y() * that->Z() - normalized_axis.Z() * that->Y()),
-              co * that->Y() + (normalized_axis.Y() * mco) * normalized_axis **that + si * (normalized_axis.Z() * that->X() - normalized_axis.X() * that->Z()),
-              co * that->Z() + (normalized_axis.Z() * mco) * normalized_axis **that + si * (normalized_axis.X() * that->Y() - normalized_axis.Y() * that->X()));
+    that->Set(co * that->X() + normalized_axis.X() * projection + si * (normalized_axis.Y() * that->Z() - normalized_axis.Z() * that->Y()),
+              co * that->Y() + normalized_axis.Y() * projection + si * (normalized_axis.Z() * that->X() - normalized_axis.X() * that->Z()),
+              co * that->Z() + normalized_axis.Z() * projection + si * (normalized_axis.X() * that->Y() - normalized_axis.Y() * that->X()));
   }
 
   template <typename TAxisElement>
@@ -191,6 +212,15 @@ public:
     return temp;
   }
 
+  template <typename TSinCosElement, typename TAxisElement>
+  inline const tVector Rotated(const tSinCos<TSinCosElement> &angle, const math::tVector<3, TAxisElement, Cartesian> &axis) const
+  {
+    const tVector *that = reinterpret_cast<const tVector *>(this);
+    tVector temp(*that);
+    temp.Rotate(angle, axis);
+    return temp;
+  }
+
 //----------------------------------------------------------------------
 // Protected methods
 //----------------------------------------------------------------------
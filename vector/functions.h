@@ -92,10 +92,10 @@ inline const tVector <Tdimension, decltype(TLeftElement() * TRightElement()), ve
 template <typename TLeftElement, typename TRightElement>
 inline const tVector <3, decltype(TLeftElement() * TRightElement()), vector::Cartesian> CrossProduct(const tVector<3, TLeftElement, vector::Cartesian> &left, const tVector<3, TRightElement, vector::Cartesian> &right) __attribute__((always_inline));
 
-template <size_t Tdimension, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
+template <typename TTrigonometryPolicy = angle::Exact, size_t Tdimension, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
 inline const tAngleRad EnclosedAngle(const tVector<Tdimension, TLeftElement, TData, TAdditionalDataParameters...> &left, const tVector<Tdimension, TRightElement, TData, TAdditionalDataParameters...> &right);
 
-template <typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
+template <typename TTrigonometryPolicy = angle::Exact, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
 const tAngleRad EnclosedAngle(const tVector<2, TLeftElement, TData, TAdditionalDataParameters...> &left, const tVector<2, TRightElement, TData, TAdditionalDataParameters...> &right);
 
 /*!
@@ -260,7 +260,7 @@ const tVector <3, decltype(TLeftElement() * TRightElement()), vector::Cartesian>
 //----------------------------------------------------------------------
 // EnclosedAngle
 //----------------------------------------------------------------------
-template <size_t Tdimension, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
+template <typename TTrigonometryPolicy, size_t Tdimension, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
 const tAngleRad EnclosedAngle(const tVector<Tdimension, TLeftElement, TData, TAdditionalDataParameters...> &left, const tVector<Tdimension, TRightElement, TData, TAdditionalDataParameters...> &right)
 {
   if (left.IsZero() || right.IsZero())
@@ -276,20 +276,20 @@ const tAngleRad EnclosedAngle(const tVector<Tdimension, TLeftElement, TData, TAd
   {
     return cPI;
   }
-  return ACos(cos_angle);
+  return ACos<TTrigonometryPolicy>(cos_angle);
 }
 
 //----------------------------------------------------------------------
 // EnclosedAngle
 //----------------------------------------------------------------------
-template <typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
+template <typename TTrigonometryPolicy, typename TLeftElement, typename TRightElement, template <size_t, typename, typename ...> class TData, typename ... TAdditionalDataParameters>
 const tAngleRad EnclosedAngle(const tVector<2, TLeftElement, TData, TAdditionalDataParameters...> &left, const tVector<2, TRightElement, TData, TAdditionalDataParameters...> &right)
 {
   if (CrossProduct(tVector<3, TLeftElement, TData, TAdditionalDataParameters...>(left), tVector<3, TRightElement, TData, TAdditionalDataParameters...>(right)).Z() < 0)
   {
-    return -EnclosedAngle(tVector<3, TLeftElement, TData, TAdditionalDataParameters...>(left), tVector<3, TRightElement, TData, TAdditionalDataParameters...>(right));
+    return -EnclosedAngle<TTrigonometryPolicy>(tVector<3, TLeftElement, TData, TAdditionalDataParameters...>(left), tVector<3, TRightElement, TData, TAdditionalDataParameters...>(right));
   }
-  return EnclosedAngle(tVector<3, TLeftElement, TData, TAdditionalDataParameters...>(left), tVector<3, TRightElement, TData, TAdditionalDataParameters...>(right));
+  return EnclosedAngle<TTrigonometryPolicy>(tVector<3, TLeftElement, TData, TAdditionalDataParameters...>(left), tVector<3, TRightElement, TData, TAdditionalDataParameters...>(right));
 }
 
 //----------------------------------------------------------------------